@@ -6,12 +6,355 @@
 
 #include "can.h"
 #include "globals.h"
+#include <SPI.h>
 
 // ===== OBDII CONSTANTS =====
 #define OBDII_PRIORITY1_INTERVAL_MS 100   // 10 Hz polling rate for priority 1 parameters
 #define OBDII_PRIORITY2_INTERVAL_MS 1000  // 1 Hz polling rate for priority 2 parameters
 #define OBDII_LAMBDA_SCALE_FACTOR 0.0000305  // OBDII lambda scaling factor
 
+// ===== MCP2515 FAST SPI INSTRUCTIONS =====
+// Frames move through the buffer-addressed instructions, one CS-low transaction each.
+// The mcp_can library is kept for begin(), masks/filters and mode changes.
+constexpr byte INSTR_READ_STATUS = 0xA0;  // One byte: RX/TX flags of every buffer
+constexpr byte INSTR_READ_RXB0 = 0x90;    // READ RX BUFFER from RXB0SIDH; RX0IF clears when CS rises
+constexpr byte INSTR_READ_RXB1 = 0x94;    // READ RX BUFFER from RXB1SIDH; RX1IF clears when CS rises
+constexpr byte INSTR_LOAD_TXB0 = 0x40;    // LOAD TX BUFFER at TXBnSIDH: TXB0 0x40, TXB1 0x42, TXB2 0x44
+constexpr byte INSTR_RTS = 0x80;          // REQUEST TO SEND, OR'd with (1 << buffer)
+
+constexpr byte STATUS_RX0IF = 0x01;       // READ STATUS bits
+constexpr byte STATUS_RX1IF = 0x02;
+constexpr byte STATUS_TXB0REQ = 0x04;     // TXB1REQ = 0x10, TXB2REQ = 0x40
+
+/**
+ * mcpSelect / mcpDeselect - Frame one MCP2515 instruction on the shared SPI bus
+ */
+static void mcpSelect(void) {
+  SPI.beginTransaction(SPISettings(CAN_SPI_CLOCK, MSBFIRST, SPI_MODE0));
+  digitalWrite(CAN0_CS, LOW);
+}
+
+static void mcpDeselect(void) {
+  digitalWrite(CAN0_CS, HIGH);
+  SPI.endTransaction();
+}
+
+/**
+ * mcpReadStatus - READ STATUS: receive flags and transmit requests in one byte
+ */
+static byte mcpReadStatus(void) {
+  mcpSelect();
+  SPI.transfer(INSTR_READ_STATUS);
+  byte status = SPI.transfer(0);
+  mcpDeselect();
+  return status;
+}
+
+/**
+ * mcpSend - Queue a standard-ID frame in the first idle transmit buffer
+ * 
+ * LOAD TX BUFFER writes ID, DLC and data in one transaction, then RTS starts the
+ * transmission. Does not wait for the frame to leave the controller.
+ * 
+ * @return true if a buffer was free
+ */
+static bool mcpSend(unsigned int id, byte dlc, const byte *data) {
+  byte status = mcpReadStatus();
+  byte n = 0;
+  while (n < 3 && (status & (STATUS_TXB0REQ << (2 * n)))) {
+    n++;  // Buffer still has a transmission pending
+  }
+  if (n == 3) {
+    return false;
+  }
+
+  mcpSelect();
+  SPI.transfer(INSTR_LOAD_TXB0 + 2 * n);
+  SPI.transfer(id >> 3);          // TXBnSIDH: ID bits 10-3
+  SPI.transfer((id & 0x07) << 5); // TXBnSIDL: ID bits 2-0, standard frame
+  SPI.transfer(0);                // TXBnEID8 (unused)
+  SPI.transfer(0);                // TXBnEID0 (unused)
+  SPI.transfer(dlc);
+  for (byte i = 0; i < dlc; i++) {
+    SPI.transfer(data[i]);
+  }
+  mcpDeselect();
+
+  mcpSelect();
+  SPI.transfer(INSTR_RTS | (1 << n));
+  mcpDeselect();
+  return true;
+}
+
+// ===== ACCEPTANCE FILTERING =====
+// Message IDs each protocol parser decodes: keep in step with parseCANHaltechV2() etc.
+// configureCANFilters() builds the software accept bitmap and the MCP2515 masks and
+// filters from the active protocol's list.
+static const uint16_t HALTECH_V2_IDS[] PROGMEM = { 0x301, 0x360, 0x361, 0x362, 0x368, 0x369,
+                                                   0x3E0, 0x3E1, 0x470, 0x471, 0x472, 0x473 };
+static const uint16_t MEGASQUIRT_IDS[] PROGMEM = { 0x5EC, 0x5F0, 0x5F1, 0x5F2, 0x5F3, 0x5F4 };
+static const uint16_t AIM_IDS[] PROGMEM = { 0x0B0, 0x0B1, 0x0B2, 0x0B3 };
+static const uint16_t OBDII_IDS[] PROGMEM = { 0x7E8, 0x7E9, 0x7EA, 0x7EB, 0x7EC, 0x7ED, 0x7EE, 0x7EF };
+#define CAN_MAX_PROTOCOL_IDS 16  // Longest list above, rounded up
+
+static uint8_t canAccept[256];  // One bit per 11-bit ID: set if the active protocol decodes it
+
+/**
+ * canAccepted - Whether the active protocol decodes a standard ID (one bit test)
+ */
+static bool canAccepted(uint16_t id) {
+  return canAccept[id >> 3] & (1 << (id & 7));
+}
+
+struct FilterGroup {
+  uint16_t value;  // ID bits the group's members share
+  uint16_t care;   // Bits on which all members agree (mask that accepts exactly the group's span)
+};
+
+/**
+ * maskSpan - Number of 11-bit IDs one filter accepts under a mask
+ */
+static uint16_t maskSpan(uint16_t care) {
+  uint16_t span = 1;
+  for (uint16_t bit = 1; bit < 0x800; bit <<= 1) {
+    if (!(care & bit)) span <<= 1;
+  }
+  return span;
+}
+
+/**
+ * planFilters - Choose the MCP2515 masks and filters that pass every listed ID
+ * 
+ * IDs start as one group each and the pair whose merge admits the fewest extra IDs is
+ * merged until six groups remain (one per filter). The groups are then split between
+ * RXB0 (mask 0, filters 0-1) and RXB1 (mask 1, filters 2-5), trying every split: a
+ * buffer's mask is the common care bits of its groups, and the split admitting the
+ * fewest IDs wins. Unused filters repeat one of their buffer's groups.
+ * 
+ * @param ids - Standard IDs to accept (n >= 1, at most CAN_MAX_PROTOCOL_IDS)
+ * @param masks - Out: mask 0 and 1
+ * @param filters - Out: filters 0-5
+ */
+static void planFilters(const uint16_t *ids, byte n, uint16_t masks[2], uint16_t filters[6]) {
+  FilterGroup g[CAN_MAX_PROTOCOL_IDS];
+  byte count = 0;
+  for (byte i = 0; i < n && count < CAN_MAX_PROTOCOL_IDS; i++) {
+    g[count].value = ids[i];
+    g[count].care = 0x7FF;
+    count++;
+  }
+
+  while (count > 6) {
+    byte bestA = 0, bestB = 1;
+    long bestExtra = 0x7FFFFFFFL;
+    for (byte a = 0; a < count; a++) {
+      for (byte b = a + 1; b < count; b++) {
+        uint16_t care = g[a].care & g[b].care & ~(g[a].value ^ g[b].value);
+        long extra = (long)maskSpan(care) - maskSpan(g[a].care) - maskSpan(g[b].care);  // Negative if they overlap
+        if (extra < bestExtra) {
+          bestExtra = extra;
+          bestA = a;
+          bestB = b;
+        }
+      }
+    }
+    g[bestA].care &= g[bestB].care & ~(g[bestA].value ^ g[bestB].value);
+    g[bestA].value &= g[bestA].care;
+    g[bestB] = g[--count];
+  }
+
+  // Bit i of split set = group i on RXB0; at most 2 groups there and 4 on RXB1
+  byte bestSplit = 0;
+  unsigned long bestCost = 0xFFFFFFFF;
+  for (byte split = 0; split < (1 << count); split++) {
+    uint16_t care[2] = { 0x7FF, 0x7FF };
+    byte used[2] = { 0, 0 };
+    for (byte i = 0; i < count; i++) {
+      byte buf = (split >> i) & 1 ? 0 : 1;
+      care[buf] &= g[i].care;
+      used[buf]++;
+    }
+    if (used[0] > 2 || used[1] > 4) continue;
+    unsigned long cost = (unsigned long)used[0] * maskSpan(care[0]) + (unsigned long)used[1] * maskSpan(care[1]);
+    if (cost < bestCost) {
+      bestCost = cost;
+      bestSplit = split;
+    }
+  }
+
+  masks[0] = masks[1] = 0x7FF;
+  byte slot[2] = { 0, 2 };  // Next filter number per buffer
+  for (byte i = 0; i < count; i++) {
+    masks[((bestSplit >> i) & 1) ? 0 : 1] &= g[i].care;
+  }
+  for (byte i = 0; i < count; i++) {
+    byte buf = ((bestSplit >> i) & 1) ? 0 : 1;
+    filters[slot[buf]++] = g[i].value & masks[buf];
+  }
+  if (slot[0] == 0) {  // RXB0 unused: mirror RXB1 (a frame matching both lands in RXB0)
+    masks[0] = masks[1];
+    filters[slot[0]++] = filters[2];
+  }
+  if (slot[1] == 2) {  // RXB1 unused: mirror RXB0
+    masks[1] = masks[0];
+    filters[slot[1]++] = filters[0];
+  }
+  for (; slot[0] < 2; slot[0]++) filters[slot[0]] = filters[0];
+  for (; slot[1] < 6; slot[1]++) filters[slot[1]] = filters[2];
+}
+
+// ===== INTERRUPT-DRIVEN RECEIVE =====
+// canRxISR() runs on the CAN0_INT falling edge and moves frames out of the MCP2515 into a
+// ring, so its two receive buffers cannot overflow during a long render. SPI.usingInterrupt()
+// makes every SPI transaction (OLED chunks, mcp_can, ours) hold the interrupt off, so the
+// ISR never lands mid-transfer; at worst it waits out one OLED chunk. The drain runs with
+// only INT3 (CAN0_INT) masked, so the Timer3 motor ISR and sensor edges still preempt it.
+#define CAN_RX_RING_SIZE 8
+#define CAN_RX_RING_MASK (CAN_RX_RING_SIZE - 1)
+
+struct CanFrame {
+  unsigned long id;    // mcp_can encoding: bit 31 = extended, bit 30 = remote request
+  unsigned long time;  // micros() at the interrupt
+  byte len;
+  byte data[8];
+};
+static volatile CanFrame canRxRing[CAN_RX_RING_SIZE];
+static volatile uint8_t canRxHead = 0;  // Written by the ISR (or serviceCAN() with INT3 masked)
+static volatile uint8_t canRxTail = 0;  // Written by main loop only
+static volatile unsigned int canRxDropped = 0;  // Frames read while the ring was full
+static volatile unsigned int canRxRejected = 0; // Frames the accept bitmap discarded
+static unsigned long canRxTime = 0;       // Interrupt time of the frame receiveCAN() returned last
+static unsigned long canLatencyMaxUs = 0; // Longest interrupt-to-parsed time since the last report
+static unsigned int canRxParsed = 0;      // Frames parsed since the last report
+
+/**
+ * mcpReadRx - READ RX BUFFER: stream one receive buffer into a frame
+ * 
+ * SIDH, SIDL, EID8, EID0, DLC and data come out in one transaction; raising CS clears
+ * the buffer's receive flag. Frames the active protocol does not decode (including all
+ * extended frames) are released after the two ID bytes.
+ * 
+ * @return false if the frame was discarded by the accept bitmap
+ */
+static bool mcpReadRx(byte instr, volatile CanFrame *f) {
+  mcpSelect();
+  SPI.transfer(instr);
+  byte sidh = SPI.transfer(0);
+  byte sidl = SPI.transfer(0);
+  if ((sidl & 0x08) || !canAccepted(((uint16_t)sidh << 3) | (sidl >> 5))) {
+    mcpDeselect();  // Flag clears here; nothing more to read
+    return false;
+  }
+  byte eid8 = SPI.transfer(0);
+  byte eid0 = SPI.transfer(0);
+  byte dlc = SPI.transfer(0);
+  byte n = min(dlc & 0x0F, 8);
+  for (byte i = 0; i < n; i++) {
+    f->data[i] = SPI.transfer(0);
+  }
+  mcpDeselect();
+  f->len = n;
+
+  // Same ID encoding as mcp_can readMsgBuf()
+  unsigned long id = ((unsigned long)sidh << 3) | (sidl >> 5);
+  if (sidl & 0x08) {  // IDE
+    id = (id << 18) | ((unsigned long)(sidl & 0x03) << 16) | ((unsigned int)eid8 << 8) | eid0;
+    id |= 0x80000000;
+    if (dlc & 0x40) id |= 0x40000000;  // RTR (extended frames)
+  } else if (sidl & 0x10) {
+    id |= 0x40000000;                  // SRR (standard frames)
+  }
+  f->id = id;
+  return true;
+}
+
+/**
+ * canDrain - Move the frames the MCP2515 holds into the ring (INT3 masked)
+ * 
+ * READ STATUS decides which buffers to read: RXB0 first, as mcp_can does. At most the two
+ * receive buffers per call, so a stuck status (no controller fitted) cannot hang the caller;
+ * a frame arriving meanwhile keeps CAN0_INT low for serviceCAN() to pick up.
+ */
+static void canDrain(unsigned long now) {
+  static CanFrame overflow;  // Target for frames that do not fit: read anyway to free the buffer
+  for (byte i = 0; i < 2; i++) {
+    byte status = mcpReadStatus();
+    byte instr;
+    if (status & STATUS_RX0IF) {
+      instr = INSTR_READ_RXB0;
+    } else if (status & STATUS_RX1IF) {
+      instr = INSTR_READ_RXB1;
+    } else {
+      return;
+    }
+    if ((uint8_t)(canRxHead - canRxTail) >= CAN_RX_RING_SIZE) {
+      if (mcpReadRx(instr, &overflow)) {
+        canRxDropped++;
+      } else {
+        canRxRejected++;
+      }
+      continue;
+    }
+    volatile CanFrame *f = &canRxRing[canRxHead & CAN_RX_RING_MASK];
+    if (!mcpReadRx(instr, f)) {
+      canRxRejected++;
+      continue;
+    }
+    f->time = now;
+    canRxHead++;
+  }
+}
+
+/**
+ * canRxISR - CAN0_INT falling edge: timestamp and drain the receive buffers
+ * 
+ * Masks its own interrupt and re-enables the rest before touching SPI: AVR ISRs do not
+ * nest, and the drain would otherwise hold off the 10 kHz Timer3 motor ISR.
+ * 
+ * Performance: ~35 µs per frame (status byte + 14-byte buffer read at 8 MHz), at most two
+ * frames; interrupts are disabled for only ~2 µs of it
+ */
+static void canRxISR() {
+  EIMSK &= ~_BV(INT3);  // CAN0_INT (pin 18) is INT3
+  sei();
+  canDrain(micros());
+  cli();
+  EIMSK |= _BV(INT3);
+}
+
+/**
+ * attachCANInterrupt - Receive on the CAN0_INT falling edge instead of polling
+ */
+void attachCANInterrupt()
+{
+  SPI.usingInterrupt(digitalPinToInterrupt(CAN0_INT));  // SPI transactions now hold the ISR off
+  attachInterrupt(digitalPinToInterrupt(CAN0_INT), canRxISR, FALLING);
+}
+
+/**
+ * canStatsReport - Print and reset receive counts and the worst interrupt-to-parsed latency
+ */
+void canStatsReport()
+{
+  noInterrupts();
+  unsigned int dropped = canRxDropped;
+  unsigned int rejected = canRxRejected;
+  canRxDropped = 0;
+  canRxRejected = 0;
+  interrupts();
+
+  Serial.print(F("can parsed "));
+  Serial.print(canRxParsed);
+  Serial.print(F(" dropped "));
+  Serial.print(dropped);
+  Serial.print(F(" rejected "));
+  Serial.print(rejected);
+  Serial.print(F(" max latency us "));
+  Serial.println(canLatencyMaxUs);
+  canRxParsed = 0;
+  canLatencyMaxUs = 0;
+}
+
 /**
  * sendCAN_LE - Send CAN message with Little Endian byte order
  */
@@ -34,7 +377,7 @@ void sendCAN_LE(int CANaddress, int inputVal_1, int inputVal_2, int inputVal_3,
         data[7] = highByte(inputVal_4);
 
         //Serial.println(inputVal_1);  // Debug output
-        byte sndStat = CAN0.sendMsgBuf(CANaddress, 0, 8, data);  // Send 8-byte message, standard ID
+        mcpSend(CANaddress, 8, data);  // Send 8-byte message, standard ID
 }
 
 /**
@@ -58,16 +401,25 @@ void sendCAN_BE(int CANaddress, int inputVal_1, int inputVal_2, int inputVal_3,
         data[6] = highByte(inputVal_4);
         data[7] = lowByte(inputVal_4);  // Fixed: was highByte, should be lowByte
 
-        byte sndStat = CAN0.sendMsgBuf(CANaddress, 0, 8, data);  // Send 8-byte message, standard ID
+        mcpSend(CANaddress, 8, data);  // Send 8-byte message, standard ID
 }
 
 /**
- * receiveCAN - Read CAN message from receive buffer
+ * receiveCAN - Take the oldest received CAN message from the ring
  */
-void receiveCAN ()
+bool receiveCAN ()
 {
-  
-    CAN0.readMsgBuf(&rxId, &len, rxBuf);  // Read message: ID, length, and data bytes
+    if (canRxTail == canRxHead) {
+      return false;  // Nothing received
+    }
+    volatile CanFrame *f = &canRxRing[canRxTail & CAN_RX_RING_MASK];
+    rxId = f->id;
+    len = f->len;
+    canRxTime = f->time;
+    for (byte i = 0; i < len; i++) {
+      rxBuf[i] = f->data[i];
+    }
+    canRxTail++;
     
     // Copy received data to processing buffer
     for (byte i =0; i< len; i++){
@@ -97,6 +449,28 @@ void receiveCAN ()
 ////        Serial.println(var/100);
 //    }      
 //    Serial.println();
+    return true;
+}
+
+/**
+ * serviceCAN - Read and parse the frames the MCP2515 is holding
+ */
+void serviceCAN()
+{
+    // INT still low means frames are waiting without an edge to come (e.g. one arrived
+    // while another was still held): drain here, with only canRxISR() held off
+    if (!digitalRead(CAN0_INT)) {
+      EIMSK &= ~_BV(INT3);
+      canDrain(micros());
+      EIMSK |= _BV(INT3);
+    }
+
+    while (receiveCAN()) {
+      parseCAN(rxId, 0);
+      unsigned long latency = micros() - canRxTime;
+      if (latency > canLatencyMaxUs) canLatencyMaxUs = latency;
+      if (canRxParsed < 0xFFFF) canRxParsed++;
+    }
 }
 
 /**
@@ -198,6 +572,7 @@ void parseCANHaltechV2(unsigned long id)
     } else {
       spdCAN = 0;  // All wheel speeds are zero
     }
+    spdCANTime = millis();
   }
 }
 
@@ -244,6 +619,7 @@ void parseCANMegasquirt(unsigned long id)
     int vss1 = rxBuf[0] + (rxBuf[1]<<8);  // Little Endian
     // Convert from km/h * 10 to km/h * 100 for spdCAN
     spdCAN = vss1 * 10;
+    spdCANTime = millis();
   }
   // Note: Megasquirt doesn't broadcast Oil Pressure, Oil Temp, Fuel Pressure by default
   // These would need to be configured as custom channels if available
@@ -267,6 +643,7 @@ void parseCANAim(unsigned long id)
     int spdKmh10 = (rxBuf[2]<<8) + rxBuf[3];
     // Convert from km/h * 10 to km/h * 100 for spdCAN (used when SPEED_SOURCE=1)
     spdCAN = spdKmh10 * 10;
+    spdCANTime = millis();
   }
   else if (id == 0x0B1) {  // Temperatures
     // Coolant temp: bytes 0-1 (deg C * 10, Big Endian)
@@ -325,6 +702,7 @@ void parseCANOBDII(unsigned long id)
       // Formula: A (km/h)
       // Convert from km/h to km/h * 100 for spdCAN (used when SPEED_SOURCE=1)
       spdCAN = rxBuf[3] * 100;
+      spdCANTime = millis();
       obdiiAwaitingResponse = false;
       break;
       
@@ -370,7 +748,7 @@ void parseCANOBDII(unsigned long id)
 void sendOBDIIRequest(uint8_t pid)
 {
   byte data[8] = {0x02, 0x01, pid, 0x00, 0x00, 0x00, 0x00, 0x00};
-  CAN0.sendMsgBuf(0x7DF, 0, 8, data);
+  mcpSend(0x7DF, 8, data);
   obdiiAwaitingResponse = true;
   obdiiCurrentPID = pid;
 }
@@ -409,95 +787,72 @@ void pollOBDII()
 }
 
 /**
- * configureCANFilters - Configure MCP2515 hardware filters based on protocol
+ * configureCANFilters - Configure acceptance filtering for the active protocol
  * 
  * The MCP2515 has 2 receive buffers with 6 filters total:
  * - RXB0: 2 filters (Filter 0, Filter 1) with Mask 0
  * - RXB1: 4 filters (Filter 2-5) with Mask 1
  * 
- * Strategy: Use masks to accept ranges of IDs, then rely on software
- * for final filtering. This reduces interrupt load significantly.
+ * Strategy: planFilters() fits the masks and filters to the protocol's ID list so the
+ * fewest unneeded IDs raise an interrupt; the accept bitmap then drops the rest with
+ * one bit test before any decoding.
  */
 void configureCANFilters()
 {
   // The init_Filt and init_Mask functions use:
   // init_Mask(num, ext, ulData) - num: 0 or 1, ext: 0=standard/1=extended
   // init_Filt(num, ext, ulData) - num: 0-5, ext: 0=standard/1=extended
+  // With ext = 0, mcp_can takes the 11-bit ID in bits 16-26 of ulData (bits 0-15 would
+  // match the first two data bytes, left as don't-care). Filtering only applies when
+  // CAN0.begin() was given MCP_STDEXT: MCP_ANY turns masks and filters off.
   
+  const uint16_t *table;
+  byte n;
   switch (CAN_PROTOCOL) {
     case CAN_PROTOCOL_HALTECH_V2:
-      // Haltech IDs: 0x301, 0x360-0x362, 0x368-0x369, 0x3E0-0x3E1, 0x470-0x473
-      // Use masks to accept ranges, reducing unnecessary interrupts
-      
-      // Mask 0 for RXB0: Accept 0x360-0x36F and 0x3E0-0x3EF (mask 0x7F0)
-      CAN0.init_Mask(0, 0, 0x7F0);
-      CAN0.init_Filt(0, 0, 0x360);  // Accepts 0x360-0x36F
-      CAN0.init_Filt(1, 0, 0x3E0);  // Accepts 0x3E0-0x3EF
-      
-      // Mask 1 for RXB1: Accept 0x470-0x47F and specific IDs (mask varies)
-      CAN0.init_Mask(1, 0, 0x7F0);
-      CAN0.init_Filt(2, 0, 0x470);  // Accepts 0x470-0x47F (wheel speeds)
-      CAN0.init_Filt(3, 0, 0x300);  // Accepts 0x300-0x30F (test messages)
-      CAN0.init_Filt(4, 0, 0x360);  // Duplicate for redundancy
-      CAN0.init_Filt(5, 0, 0x3E0);  // Duplicate for redundancy
+      table = HALTECH_V2_IDS;
+      n = sizeof(HALTECH_V2_IDS) / sizeof(HALTECH_V2_IDS[0]);
       break;
-      
     case CAN_PROTOCOL_MEGASQUIRT:
-      // Megasquirt IDs: 0x5EC, 0x5F0-0x5F4
-      // These are close together, can use a mask
-      
-      // Mask 0 for RXB0: Accept 0x5E0-0x5EF
-      CAN0.init_Mask(0, 0, 0x7F0);
-      CAN0.init_Filt(0, 0, 0x5E0);  // Accepts 0x5E0-0x5EF (includes 0x5EC)
-      CAN0.init_Filt(1, 0, 0x5F0);  // Accepts 0x5F0-0x5FF
-      
-      // Mask 1 for RXB1: Accept 0x5F0-0x5FF
-      CAN0.init_Mask(1, 0, 0x7F0);
-      CAN0.init_Filt(2, 0, 0x5F0);  // Accepts 0x5F0-0x5FF
-      CAN0.init_Filt(3, 0, 0x5F0);  // Duplicate for redundancy
-      CAN0.init_Filt(4, 0, 0x5E0);  // Accepts 0x5E0-0x5EF
-      CAN0.init_Filt(5, 0, 0x5E0);  // Duplicate for redundancy
+      table = MEGASQUIRT_IDS;
+      n = sizeof(MEGASQUIRT_IDS) / sizeof(MEGASQUIRT_IDS[0]);
       break;
-      
     case CAN_PROTOCOL_AIM:
-      // AiM IDs: 0x0B0-0x0B3
-      // Very compact range
-      
-      // Mask 0 for RXB0: Accept 0x0B0-0x0BF
-      CAN0.init_Mask(0, 0, 0x7F0);
-      CAN0.init_Filt(0, 0, 0x0B0);  // Accepts 0x0B0-0x0BF
-      CAN0.init_Filt(1, 0, 0x0B0);  // Duplicate for redundancy
-      
-      // Mask 1 for RXB1: Accept 0x0B0-0x0BF
-      CAN0.init_Mask(1, 0, 0x7F0);
-      CAN0.init_Filt(2, 0, 0x0B0);  // Accepts 0x0B0-0x0BF
-      CAN0.init_Filt(3, 0, 0x0B0);  // Duplicate for redundancy
-      CAN0.init_Filt(4, 0, 0x0B0);  // Duplicate for redundancy
-      CAN0.init_Filt(5, 0, 0x0B0);  // Duplicate for redundancy
+      table = AIM_IDS;
+      n = sizeof(AIM_IDS) / sizeof(AIM_IDS[0]);
       break;
-      
     case CAN_PROTOCOL_OBDII:
-      // OBDII response IDs: 0x7E8-0x7EF
-      // Single contiguous range
-      
-      // Mask 0 for RXB0: Accept 0x7E8-0x7EF (mask 0x7F8)
-      CAN0.init_Mask(0, 0, 0x7F8);
-      CAN0.init_Filt(0, 0, 0x7E8);  // Accepts 0x7E8-0x7EF
-      CAN0.init_Filt(1, 0, 0x7E8);  // Duplicate for redundancy
-      
-      // Mask 1 for RXB1: Accept 0x7E8-0x7EF
-      CAN0.init_Mask(1, 0, 0x7F8);
-      CAN0.init_Filt(2, 0, 0x7E8);  // Accepts 0x7E8-0x7EF
-      CAN0.init_Filt(3, 0, 0x7E8);  // Duplicate for redundancy
-      CAN0.init_Filt(4, 0, 0x7E8);  // Duplicate for redundancy
-      CAN0.init_Filt(5, 0, 0x7E8);  // Duplicate for redundancy
+      table = OBDII_IDS;
+      n = sizeof(OBDII_IDS) / sizeof(OBDII_IDS[0]);
       break;
-      
     default:
-      // Unknown protocol - accept all messages (no filtering)
-      CAN0.init_Mask(0, 0, 0x00000000);  // Mask all zeros = accept all
-      CAN0.init_Mask(1, 0, 0x00000000);
+      table = NULL;
+      n = 0;
       break;
   }
-}
 
+  uint16_t ids[CAN_MAX_PROTOCOL_IDS];
+  memset(canAccept, 0, sizeof(canAccept));
+  for (byte i = 0; i < n && i < CAN_MAX_PROTOCOL_IDS; i++) {
+    ids[i] = pgm_read_word(&table[i]);
+    canAccept[ids[i] >> 3] |= 1 << (ids[i] & 7);
+  }
+
+  uint16_t masks[2];
+  uint16_t filters[6];
+  if (n == 0) {
+    // Unknown protocol: nothing is decoded. Filters cannot be switched off, so pass only ID 0x000
+    masks[0] = masks[1] = 0x7FF;
+    memset(filters, 0, sizeof(filters));
+  } else {
+    planFilters(ids, min(n, CAN_MAX_PROTOCOL_IDS), masks, filters);
+  }
+
+  CAN0.init_Mask(0, 0, (unsigned long)masks[0] << 16);
+  CAN0.init_Filt(0, 0, (unsigned long)filters[0] << 16);
+  CAN0.init_Filt(1, 0, (unsigned long)filters[1] << 16);
+  CAN0.init_Mask(1, 0, (unsigned long)masks[1] << 16);
+  for (byte i = 2; i < 6; i++) {
+    CAN0.init_Filt(i, 0, (unsigned long)filters[i] << 16);
+  }
+}
@@ -53,12 +53,19 @@ void sendCAN_LE(int CANaddress, int inputVal_1, int inputVal_2, int inputVal_3,
 void sendCAN_BE(int CANaddress, int inputVal_1, int inputVal_2, int inputVal_3, int inputVal_4);
 
 /**
- * receiveCAN - Read CAN message from receive buffer
+ * receiveCAN - Take the oldest received CAN message
  * 
- * Reads a CAN message from the MCP2515 controller's receive buffer.
- * Called when CAN interrupt pin goes low (message waiting).
+ * Frames are moved out of the MCP2515 by the CAN0_INT interrupt (attachCANInterrupt())
+ * into an 8-frame ring; this pops one for parsing.
  * Message data is copied to canMessageData[] for parsing.
  * 
+ * The interrupt uses the MCP2515 fast instructions directly: READ STATUS finds the full
+ * buffers, READ RX BUFFER streams ID, DLC and data in one transaction and clears the
+ * receive flag when CS rises. Sends use LOAD TX BUFFER + RTS the same way. rxId keeps
+ * the mcp_can encoding (bit 31 extended, bit 30 remote request).
+ * 
+ * @return false if no message was waiting (globals unchanged)
+ * 
  * Global variables modified:
  * - rxId: CAN message identifier
  * - len: Number of data bytes (0-8)
@@ -67,7 +74,36 @@ void sendCAN_BE(int CANaddress, int inputVal_1, int inputVal_2, int inputVal_3,
  * 
  * The commented-out debug code can be enabled to print CAN messages to serial.
  */
-void receiveCAN();
+bool receiveCAN();
+
+/**
+ * serviceCAN - Parse every received CAN message
+ * 
+ * Drains the receive ring through parseCAN(). If CAN0_INT is still low (frames waiting
+ * with no edge to come), reads the MCP2515 first with the interrupt held off.
+ * Called from the main loop only: screens record the values they drew after flushing,
+ * so parsing must not run inside an OLED transfer.
+ */
+void serviceCAN();
+
+/**
+ * attachCANInterrupt - Receive on the CAN0_INT falling edge instead of polling
+ * 
+ * The ISR timestamps the edge and reads every full receive buffer into the ring, so
+ * the MCP2515's two buffers cannot overflow during slow loop passes. Registers the
+ * interrupt with SPI.usingInterrupt() so SPI transactions elsewhere hold it off.
+ * 
+ * Call after CAN0.setMode(MCP_NORMAL).
+ */
+void attachCANInterrupt();
+
+/**
+ * canStatsReport - Print and reset CAN receive statistics ("can stats" command)
+ * 
+ * Frames parsed, frames dropped because the ring was full, and the longest time from
+ * the interrupt to the frame's values being parsed, since the last report.
+ */
+void canStatsReport();
 
 /**
  * parseCAN - Parse received CAN message based on ID
@@ -165,8 +201,9 @@ void pollOBDII();
  * - 6 acceptance filters (2 for RXB0, 4 for RXB1)
  * - 2 acceptance masks (1 for each buffer)
  * 
- * Filters are configured based on CAN_PROTOCOL setting to accept only
- * relevant message IDs for the selected ECU protocol.
+ * Masks and filters are planned from the CAN_PROTOCOL setting's list of decoded
+ * IDs to admit as few other IDs as possible. The same list fills a 2048-bit accept
+ * bitmap that drops any remaining unneeded frame before it is read out or decoded.
  * 
  * Should be called after CAN0.begin() and before CAN0.setMode(MCP_NORMAL)
  */
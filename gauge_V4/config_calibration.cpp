@@ -41,11 +41,17 @@ uint8_t TEETH_PER_REV = 8;         // Teeth per revolution of the VSS
 uint8_t FILTER_HALL_SPEED = 64;    // EMA filter coefficient (205/256 ≈ 0.8)
 uint8_t HALL_SPEED_MIN = 50;        // Minimum reportable speed in km/h*100 (50 = 0.5 km/h)
 
+// ===== SPEED FUSION PARAMETERS =====
+uint8_t ALPHA_SPEED_CAL = 8;        // Hall scale learning rate per GPS fix (8/256 ≈ 3%)
+uint16_t SPEED_CAL_MIN = 4000;      // Only learn Hall scale above 40 km/h (GPS speed noise is proportionally small)
+
 // ===== ENGINE RPM SENSOR PARAMETERS =====
 uint8_t CYL_COUNT = 8;              // Cylinder count (8 = 2x old PULSES_PER_REVOLUTION of 4.0)
 uint8_t FILTER_ENGINE_RPM = 179;    // EMA filter coefficient (179/256 ≈ 0.7)
 uint16_t RPM_DEBOUNCE_MICROS = 5000; // Debounce window: reject pulses within 5 ms of last accepted pulse
 uint8_t ENGINE_RPM_MIN = 100;       // Minimum reportable RPM
+uint8_t TRIGGER_WHEEL_TEETH = 0;    // 0 = coil pulses; 36 = 36-1 wheel, 60 = 60-2 wheel
+uint8_t TRIGGER_WHEEL_MISSING = 1;  // Missing teeth in the trigger wheel gap
 
 // ===== SPEEDOMETER CALIBRATION =====
 uint16_t SPEEDO_MAX = 100 * 100;    // Maximum speedometer reading
@@ -69,7 +75,7 @@ uint8_t ODO_MOTOR_TEETH = 16;       // Number of teeth on motor gear
 uint8_t ODO_GEAR_TEETH = 20;        // Number of teeth on odometer gear
 
 // ===== SIGNAL SOURCE SELECTION =====
-uint8_t SPEED_SOURCE = 2;           // 0=off, 1=CAN, 2=Hall sensor, 3=GPS, 4=Synthetic (debug), 5=Odometer test (1-mile profile)
+uint8_t SPEED_SOURCE = 2;           // 0=off, 1=CAN, 2=Hall sensor, 3=GPS, 4=Synthetic (debug), 5=Odometer test (1-mile profile), 6=Serial, 7=Fused
 uint8_t RPM_SOURCE = 2;             // 0=off, 1=CAN, 2=coil negative, 3=Synthetic (debug)
 uint8_t OIL_PRS_SOURCE = 5;         // 0=off, 1=CAN, 2=sensor_av1, 3=sensor_av2, 4=sensor_av3, 5=Synthetic (debug)
 uint8_t FUEL_PRS_SOURCE = 5;        // 0=off, 1=CAN, 2=sensor_av1, 3=sensor_av2, 4=sensor_av3, 5=Synthetic (debug)
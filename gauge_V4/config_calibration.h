@@ -58,6 +58,10 @@ extern uint8_t TEETH_PER_REV;         // Teeth per revolution (sensor-specific)
 extern uint8_t FILTER_HALL_SPEED;   // EMA filter coefficient (0-256): 256=no filter, 128=moderate, 64=heavy
 extern uint8_t HALL_SPEED_MIN;      // Minimum reportable speed in km/h*100 (e.g., 50 = 0.5 km/h)
 
+// ===== SPEED FUSION PARAMETERS (SPEED_SOURCE = 7) =====
+extern uint8_t ALPHA_SPEED_CAL;     // Hall scale learning rate per GPS fix (0-256): 8 = ~32 fixes to converge
+extern uint16_t SPEED_CAL_MIN;      // Minimum GPS speed for Hall scale learning in km/h*100 (e.g., 4000 = 40 km/h)
+
 // ===== ENGINE RPM SENSOR PARAMETERS =====
 // Cylinder count (for 4-stroke engines)
 // Examples: 4-cyl=4, 6-cyl=6, 8-cyl=8, 3-cyl=3
@@ -74,6 +78,14 @@ extern uint16_t RPM_DEBOUNCE_MICROS;
 // Minimum reportable RPM (engine idle ~600-800)
 extern uint8_t ENGINE_RPM_MIN;
 
+// Crank trigger wheel on the RPM input (instead of one pulse per firing)
+// TRIGGER_WHEEL_TEETH: 0 = coil/tach signal (uses CYL_COUNT), else total tooth positions
+// including missing teeth (e.g., 36 for 36-1, 60 for 60-2)
+// TRIGGER_WHEEL_MISSING: number of missing teeth in the gap (e.g., 1 for 36-1, 2 for 60-2)
+// RPM is derived once per revolution at the missing-tooth gap; RPM_DEBOUNCE_MICROS is not used.
+extern uint8_t TRIGGER_WHEEL_TEETH;
+extern uint8_t TRIGGER_WHEEL_MISSING;
+
 // ===== SPEEDOMETER CALIBRATION =====
 extern uint16_t SPEEDO_MAX;    // Maximum speedometer reading: 100 mph * 100 (stored as integer for precision)
 
@@ -93,7 +105,7 @@ extern uint8_t ODO_GEAR_TEETH;        // Number of teeth on odometer gear
 // These parameters determine which sensor/source to use for each signal
 // This allows flexible configuration of data sources
 
-// Speed source for both speedometer and odometer: 0=off, 1=CAN, 2=Hall sensor, 3=GPS, 4=Synthetic (debug), 5=Odometer test (1-mile profile), 6=Serial (set via serial commands)
+// Speed source for both speedometer and odometer: 0=off, 1=CAN, 2=Hall sensor, 3=GPS, 4=Synthetic (debug), 5=Odometer test (1-mile profile), 6=Serial (set via serial commands), 7=Fused (Hall + CAN + GPS)
 extern uint8_t SPEED_SOURCE;
 
 // Engine RPM source: 0=off, 1=CAN, 2=coil negative, 3=synthetic (debug), 4=Serial (set via serial commands)
@@ -18,7 +18,8 @@
 
 // ===== CAN BUS HARDWARE =====
 constexpr uint8_t CAN0_CS = 53;     // MCP2515 CAN controller chip select pin (SPI)
-constexpr uint8_t CAN0_INT = 18;    // MCP2515 interrupt pin - triggers when CAN message received
+constexpr uint8_t CAN0_INT = 18;    // MCP2515 interrupt pin (INT3) - falls when a CAN message is received
+constexpr uint32_t CAN_SPI_CLOCK = 10000000UL;  // MCP2515 SPI clock limit: 10 MHz (AVR runs it at 8 MHz)
 
 // ===== ENGINE RPM SENSOR =====
 constexpr uint8_t IGNITION_PULSE_PIN = 21;  // Digital pin D21 - ignition coil pulses via optocoupler (interrupt-capable)
@@ -58,6 +59,13 @@ constexpr uint8_t SCREEN_H = 32;    // OLED display height in pixels
 
 // SPI Communication Settings
 constexpr uint32_t OLED_SPI_CLOCK = 8000000UL;  // OLED display SPI clock speed: 8 MHz (8,000,000 Hz)
+constexpr uint8_t OLED_CHUNK_BYTES = 64;        // Frame bytes per OLED bus hold (~110 µs); pending CAN frames are read between chunks
+constexpr bool DISPLAY_STATS = false;           // Set to true to also count flushes per screen for "disp stats" (debug only)
+
+// Panels on the shared SPI bus: display 1 runs the menu, displays 2..NUM_DISPLAYS each show
+// a selectable screen. Adding a panel: raise NUM_DISPLAYS, add its pins here and a row in
+// the displays[] table (globals.cpp).
+constexpr uint8_t NUM_DISPLAYS = 2;
 
 // Display 1 Configuration (SPI interface)
 constexpr uint8_t OLED_DC_1 = 6;    // Display 1 Data/Command pin
@@ -75,6 +83,22 @@ constexpr uint8_t TACH_DATA_PIN = 22; // WS2812 data pin for LED tachometer stri
 
 // ===== GPS CONFIGURATION =====
 constexpr bool GPSECHO = false;     // Set to true to echo raw GPS data to serial monitor (debug only)
+constexpr unsigned long GPS_BAUD_DEFAULT = 9600;  // Receiver power-on baud rate (MTK3339 default)
+constexpr unsigned long GPS_BAUD = 38400;         // Operating baud rate (keep PMTK_SET_BAUD / UBX_CFG_PRT in gps.cpp in sync)
+constexpr unsigned int GPS_BAUD_SWITCH_MS = 50;   // Wait after the baud command: last byte on the wire + receiver switch
+constexpr unsigned int GPS_EXTRAPOLATE_MS = 200;  // Dead-reckoning horizon past the last fix; speed holds beyond this
+constexpr long GPS_SPEED_MAX = 40000;              // Dead-reckoned speed ceiling (km/h * 100)
+
+// GPS-disciplined timebase (timebase.cpp): millis() drift measured against fix time
+constexpr unsigned long TIMEBASE_WINDOW_MS = 300000UL;  // GPS time per drift measurement (5 min, ~20 ppm resolution)
+constexpr unsigned long TIMEBASE_MAX_PPM = 5000UL;      // Largest plausible oscillator error (ceramic resonator worst case)
+constexpr long TIMEBASE_JITTER_MS = 50;                 // Fix arrival jitter tolerated before a window is discarded
+
+// GPS receiver protocol: NMEA RMC for MTK receivers (Adafruit Ultimate GPS),
+// UBX NAV-PVT binary for u-blox receivers (no ASCII number parsing)
+constexpr uint8_t GPS_PROTOCOL_NMEA = 0;
+constexpr uint8_t GPS_PROTOCOL_UBX = 1;
+constexpr uint8_t GPS_PROTOCOL = GPS_PROTOCOL_NMEA;
 
 // ===== ANALOG SENSOR INPUT PINS =====
 // Battery Voltage Sensor (Analog Pin A0)
@@ -100,6 +124,28 @@ constexpr unsigned long MAX_VALID_PULSE_INTERVAL = 500000UL; // Max pulse interv
 constexpr unsigned long SPEED_DECAY_THRESHOLD = 200000UL; // Time (μs) before speed starts decaying (200ms)
 constexpr uint8_t SPEED_DECAY_FACTOR = 230;  // Speed decay multiplier (230/256 ≈ 0.9, or 10% decay per cycle)
 constexpr uint8_t PULSES_TO_SKIP_AFTER_STANDSTILL = 2;  // Number of initial pulses to skip after standstill
+constexpr unsigned long HALL_COUNT_ENTER_INTERVAL = 1000UL; // Switch to pulse counting below this interval (μs, >1 kHz)
+constexpr unsigned long HALL_COUNT_EXIT_INTERVAL = 1500UL;  // Back to per-interval mode above this (μs, hysteresis)
+
+// ===== INPUT CAPTURE (OPTIONAL HARDWARE ROUTING) =====
+// Hardware-latched pulse timestamps: Timer4/Timer5 at prescaler 8 = 0.5 µs per tick.
+// The edge latches the counter, so Timer3/Timer0 ISR latency no longer adds jitter.
+// Requires the conditioned signal to be wired to an ICP pin instead of D20/D21:
+// - Hall:     ICP5 = D48 (PL1), free on V4 boards
+// - Ignition: ICP4 = D49 (PL0), shared with PWR_PIN on V4 boards - move PWR_PIN first
+// WARNING: Enabling takes Timer4/Timer5 out of PWM mode (no analogWrite on D6-D8, D44-D46)
+constexpr bool HALL_INPUT_CAPTURE = false;      // true = Hall on ICP5, false = D20 external interrupt
+constexpr bool IGNITION_INPUT_CAPTURE = false;  // true = ignition on ICP4, false = D21 external interrupt
+constexpr uint8_t HALL_ICP_PIN = 48;            // ICP5 input (Timer5)
+constexpr uint8_t IGNITION_ICP_PIN = 49;        // ICP4 input (Timer4)
+static_assert(!IGNITION_INPUT_CAPTURE || IGNITION_ICP_PIN != PWR_PIN,
+              "IGNITION_INPUT_CAPTURE needs D49: reassign PWR_PIN first");
+
+// ===== SPEED FUSION TIMEOUTS (SPEED_SOURCE = 7) =====
+constexpr unsigned int CAN_SPEED_STALE_MS = 500;    // CAN speed older than this is ignored
+constexpr unsigned int GPS_STALE_MS = 1000;         // GPS fix older than this is ignored (10 missed fixes at 10 Hz)
+constexpr unsigned int HALL_FAULT_MS = 2000;        // Hall silent this long while GPS/CAN report motion = sensor fault
+constexpr unsigned int HALL_FAULT_SPEED = 1500;     // Reference speed (km/h*100) above which Hall must be pulsing
 
 // ===== ENGINE RPM SENSOR TIMEOUT =====
 constexpr unsigned long IGNITION_PULSE_TIMEOUT = 500000UL; // Timeout (μs) for "engine stopped" (0.5 second)
@@ -114,12 +160,14 @@ constexpr uint8_t ODO_PIN4 = 11;    // Odometer motor coil 4 pin
 // Update rate periods (in milliseconds)
 constexpr unsigned int CAN_SEND_RATE = 50;        // Send CAN messages every 50ms (20Hz)
 constexpr unsigned int DISP_UPDATE_RATE = 150;     // Update displays every 100ms (~10Hz)
+constexpr unsigned int DISP_GOV_MIN_MS = 33;      // Fastest adaptive display refresh (30Hz)
+constexpr unsigned int DISP_GOV_MAX_MS = 1000;    // Slowest adaptive display refresh (1Hz)
+constexpr unsigned long DISP_BUDGET_US = 150000;  // Display render + SPI time per second for all OLEDs (15%), leaving the bus to CAN
 constexpr unsigned int SENSOR_READ_RATE = 20;     // Read analog sensors every 20ms (50Hz for responsive readings)
 constexpr unsigned int TACH_UPDATE_RATE = 50;     // Update LED tachometer every 50ms (20Hz)
 constexpr unsigned int TACH_FLASH_RATE = 50;      // Flash shift light every 50ms when over redline
 constexpr unsigned int SIG_SELECT_UPDATE_RATE = 10; // Update signal selection/synthetic generators every 10ms (100Hz)
 constexpr unsigned int GPS_UPDATE_RATE = 100;     // GPS update check rate (might not be needed)
-constexpr unsigned int CHECK_GPS_RATE = 1;        // Check for GPS data every 1ms
 constexpr unsigned int ANGLE_UPDATE_RATE = 150;    // Update motor angles every 150ms (~7Hz)
 constexpr unsigned int SPLASH_TIME = 1500;        // Duration of startup splash screens (milliseconds)
 constexpr unsigned int HALL_UPDATE_RATE = 20;     // Recalculate Hall sensor speed every 20ms (50Hz)
@@ -11,119 +11,642 @@
 #include "utilities.h"
 #include <EEPROM.h>
 
-void dispMenu() {
-  bool forceDisplayUpdate = false;  // Flag to force display update after returning from submenu
-  
-  // Snapshot dispArray1[0] NOW, before the switch body runs.
-  // The rotate() ISR can fire mid-function (OLED SPI takes ~10-20 ms) and change
-  // dispArray1[0] to the *next* screen.  If we then write dispArray1_prev[0] with
-  // the new value, the next call sees modeChanged=false for the new screen while
-  // the hardware still shows old content — the "stuck screen" bug.
-  // By saving the value drawn here we ensure dispArray1_prev[0] always reflects
-  // what was actually rendered, not a later ISR update.
-  byte drawnScreen = dispArray1[0];
-  
-  switch (dispArray1[0]) {  // Level 0 - Main menu selection
-    
-    case 1:  // Oil Pressure Display                 dispArray1 = {1, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag (no action - this is a display screen only)
-      }
-      dispOilPrsGfx(&display1);  // Show oil pressure with icon
-      break;
-    
-    case 2:  // Coolant Temperature Display           dispArray1 = {2, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag
-      }
-      dispCoolantTempGfx(&display1);  // Show coolant temp with thermometer icon
-      break;
-    
-    case 3:  // Fuel Level Display                    dispArray1 = {3, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag
-      }
-      dispFuelLvlGfx(&display1);  // Show fuel level in gallons/liters with icon
-      break;
-    
-    case 4:  // Battery Voltage Display               dispArray1 = {4, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag
-      }
-      dispBattVoltGfx(&display1);  // Show battery voltage with battery icon
-      break;
+// ===== LARGE DIGIT BLITTER =====
+// Numbers at text size 3 are copied from FONT_DIGITS_X3 column bytes straight into the
+// SSD1306 buffer. Adafruit_GFX would issue one fillRect per font pixel for the same text.
+static const char FONT_DIGITS_X3_CHARS[] = "0123456789.-:%";  // Glyph order in FONT_DIGITS_X3
+constexpr uint8_t FONT_X3_COLS = 15;     // Glyph width (5 font columns x 3)
+constexpr uint8_t FONT_X3_ADVANCE = 18;  // Cell width, same as setTextSize(3)
+constexpr uint8_t FONT_X3_BYTES = 45;    // 15 columns x 3 pages
 
-    case 5:  // RPM Display                           dispArray1 = {5, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag
+/**
+ * drawBigText - Blit a numeric string at text size 3 into the display buffer
+ * 
+ * Equivalent to setTextSize(3) + print() for the characters in FONT_DIGITS_X3_CHARS;
+ * anything else (e.g. space) advances one cell without drawing. Any y is allowed:
+ * each 24-bit glyph column is shifted once and ORed into the pages it covers.
+ * 
+ * @return x position after the last character (the text cursor is moved there too)
+ */
+static int16_t drawBigText(Adafruit_SSD1306 *display, int16_t x, int16_t y, const char *text) {
+  uint8_t *buffer = display->getBuffer();
+  int16_t width = display->width();
+  uint8_t pages = display->height() / 8;
+  uint8_t page = y >> 3;
+  uint8_t shift = y & 7;
+
+  for (; *text; text++, x += FONT_X3_ADVANCE) {
+    const char *slot = strchr(FONT_DIGITS_X3_CHARS, *text);
+    if (slot == NULL) continue;
+    const unsigned char *glyph = FONT_DIGITS_X3 + (slot - FONT_DIGITS_X3_CHARS) * FONT_X3_BYTES;
+
+    for (uint8_t col = 0; col < FONT_X3_COLS; col++, glyph += 3) {
+      int16_t px = x + col;
+      if (px < 0 || px >= width) continue;  // Clip like GFX does
+      uint32_t bits = (uint32_t)pgm_read_byte(glyph)
+                    | ((uint32_t)pgm_read_byte(glyph + 1) << 8)
+                    | ((uint32_t)pgm_read_byte(glyph + 2) << 16);
+      bits <<= shift;
+      uint8_t *dst = buffer + page * width + px;
+      for (uint8_t p = page; p < pages && bits; p++, dst += width, bits >>= 8) {
+        *dst |= (uint8_t)bits;
       }
-      dispRPM(&display1);  // Show engine RPM
-      break;
+    }
+  }
+  display->setCursor(x, y);
+  return x;
+}
 
-    case 6:  // Speed Display                         dispArray1 = {6, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag
-      }
-      dispSpd(&display1);  // Show speed in km/h or mph based on units setting
-      break;
+// ===== FIXED-POINT VALUE FORMATTING =====
+// A reading enters the render path once, as tenths of its base unit (toTenths()). Unit
+// conversion, rounding, digit generation and text width are then all integer work, and
+// the dirty checks (needsUpdate_*) compare exactly the value the screen will print.
+struct UnitConv {
+  long mul;    // out = (in * mul + offset * div) / div, in and out both in tenths
+  long div;
+  int offset;  // Output tenths
+};
+static const UnitConv UNIT_CONV[] PROGMEM = {
+  { 1,    1,     0    },  // CONV_NONE
+  { 9,    5,     320  },  // CONV_C_TO_F       °F = °C * 1.8 + 32
+  { 1,    100,   0    },  // CONV_KPA_TO_BAR
+  { 2366, 16313, 0    },  // CONV_KPA_TO_PSI   0.1450377
+  { 2366, 16313, -147 },  // CONV_KPA_TO_PSIG  absolute kPa to gauge PSI (- 14.7)
+  { 1006, 1619,  0    },  // CONV_KM_TO_MI     0.6213712 (also km/h to mph)
+  { 3785, 1000,  0    },  // CONV_GAL_TO_L
+};
+constexpr byte CONV_NONE = 0;
+constexpr byte CONV_C_TO_F = 1;
+constexpr byte CONV_KPA_TO_BAR = 2;
+constexpr byte CONV_KPA_TO_PSI = 3;
+constexpr byte CONV_KPA_TO_PSIG = 4;
+constexpr byte CONV_KM_TO_MI = 5;
+constexpr byte CONV_GAL_TO_L = 6;
+
+// Text anchoring for drawBigNumber()
+constexpr byte ALIGN_LEFT = 0;    // x = left edge
+constexpr byte ALIGN_CENTER = 1;  // x = center
+constexpr byte ALIGN_RIGHT = 2;   // x = right edge (after the last cell)
+
+// toTenths - Round a float reading to tenths (the only float step per reading)
+static long toTenths(float val) {
+  return (long)(val * 10.0f + (val < 0 ? -0.5f : 0.5f));
+}
 
-    case 7:  // Air/Fuel Ratio Display                dispArray1 = {7, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag
-      }
-      dispAFR(&display1);  // Show AFR (e.g., 14.7)
-      break;
+/**
+ * displayValue - Convert a reading to its display unit at the precision shown
+ * 
+ * Conversion and rounding (half away from zero) to the printed precision happen in one
+ * step, so converting units adds no rounding of its own. The input has already been
+ * rounded to tenths by toTenths(), though, so a whole-unit result can be off by up to
+ * 0.05 at a boundary (89.46 -> 895 tenths -> 90).
+ * tenths * mul is a 32-bit long: inputs up to ~565,000 tenths are safe for every
+ * conversion in UNIT_CONV (CONV_GAL_TO_L sets that limit; CONV_KM_TO_MI, used for the
+ * trip odometer, takes up to ~2,130,000 tenths).
+ * 
+ * @param tenths - Reading in tenths of its base unit
+ * @param conv - CONV_* entry of UNIT_CONV
+ * @param decimals - 0 (returns whole units) or 1 (returns tenths)
+ */
+static long displayValue(long tenths, byte conv, byte decimals) {
+  UnitConv c;
+  memcpy_P(&c, &UNIT_CONV[conv], sizeof(c));
+  long num = tenths * c.mul + (long)c.offset * c.div;
+  long den = decimals ? c.div : c.div * 10;
+  return (num + (num < 0 ? -den / 2 : den / 2)) / den;
+}
 
-    case 8:  // Fuel Pressure Display                 dispArray1 = {8, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag
-      }
-      dispFuelPrs(&display1);  // Show fuel pressure in PSI or bar
-      break;
+/**
+ * formatFixed - Write a fixed-point integer as text, e.g. (-53, 1) -> "-5.3"
+ * @param buf - At least 13 bytes
+ * @param val - Value in units of 10^-decimals
+ * @return Number of characters (text width = characters * cell advance)
+ */
+static uint8_t formatFixed(char *buf, long val, uint8_t decimals) {
+  char rev[12];
+  uint8_t n = 0;
+  uint8_t digitCount = 0;
+  unsigned long u = (val < 0) ? -(unsigned long)val : (unsigned long)val;
+  do {  // Digits least significant first, with the point after 'decimals' of them
+    if (decimals && digitCount == decimals) rev[n++] = '.';
+    rev[n++] = '0' + (u % 10);
+    u /= 10;
+    digitCount++;
+  } while (u || digitCount <= decimals);
+
+  uint8_t len = 0;
+  if (val < 0) buf[len++] = '-';
+  while (n) buf[len++] = rev[--n];
+  buf[len] = '\0';
+  return len;
+}
 
-    case 9:  // Boost Gauge Display (with bar)        dispArray1 = {9, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag
-      }
-      dispBoostGfx(&display1);  // Show boost with turbo icon and bar gauge
-      break;
+/**
+ * drawBigNumber - Draw a fixed-point value at text size 3 through the blitter
+ * @param val - Value in units of 10^-decimals (see displayValue())
+ * @param align - ALIGN_LEFT / ALIGN_CENTER / ALIGN_RIGHT: what x refers to
+ * @return x just right of the last character cell (labels are placed from here)
+ */
+static int16_t drawBigNumber(Adafruit_SSD1306 *display, int16_t x, int16_t y, long val, uint8_t decimals,
+                             byte align = ALIGN_LEFT) {
+    char buf[13];
+    int16_t width = formatFixed(buf, val, decimals) * FONT_X3_ADVANCE;
+    if (align == ALIGN_CENTER) x -= width / 2;
+    else if (align == ALIGN_RIGHT) x -= width;
+    return drawBigText(display, x, y, buf);
+}
 
-    case 10:  // Boost Display (text only)            dispArray1 = {10, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag
+// speedTenths - km/h x100 (spd) to km/h x10
+static long speedTenths(int kmh100) {
+  return ((long)kmh100 + (kmh100 < 0 ? -5 : 5)) / 10;
+}
+
+/**
+ * drawTemperature - Large temperature centered on x, with degree symbol and C/F label
+ * @param tempC - Reading in °C, converted per 'units'
+ */
+static void drawTemperature(Adafruit_SSD1306 *display, int16_t center, float tempC) {
+    long temp = displayValue(toTenths(tempC), (units == 0) ? CONV_NONE : CONV_C_TO_F, 0);
+    int16_t x = drawBigNumber(display, center, 6, temp, 0, ALIGN_CENTER);
+    display->drawCircle(x+3, 7, 2, WHITE);  // Degree symbol (small circle)
+    display->setTextSize(3);
+    display->setCursor(x+9,6);
+    display->println((units == 0) ? "C" : "F");
+}
+
+/**
+ * drawPressure - Large pressure value right of a label or icon, negatives shown as 0
+ * 
+ * Metric: bar with 1 decimal, centered on x=79, small "bar" label.
+ * Imperial: PSI with no decimals, centered on x=71, "PSI" label at text size 2.
+ * 
+ * @param kPa - Gauge pressure in kPa
+ */
+static void drawPressure(Adafruit_SSD1306 *display, float kPa) {
+    if (units == 0) {
+      long bar = displayValue(toTenths(kPa), CONV_KPA_TO_BAR, 1);
+      int16_t x = drawBigNumber(display, 79, 6, max(bar, 0L), 1, ALIGN_CENTER);
+      display->setCursor(x+3,18);
+      display->setTextSize(1);
+      display->println("bar");
+    } else {
+      long psi = displayValue(toTenths(kPa), CONV_KPA_TO_PSI, 0);
+      int16_t x = drawBigNumber(display, 71, 6, max(psi, 0L), 0, ALIGN_CENTER);
+      display->setCursor(x+2,10);
+      display->setTextSize(2);
+      display->println("PSI");
+    }
+}
+
+/**
+ * writeColumnBits - Overwrite a vertical run of pixels in one column with a bit pattern
+ * 
+ * Pattern fill primitive: rows y..y+h-1 of column x take bits 0..h-1 of 'bits'
+ * (bit 0 = top). Each covered page is updated with one masked byte write, so a
+ * 16-row run costs at most 3 byte writes instead of 16 drawPixel() calls.
+ * Pixels outside the run are left untouched.
+ * 
+ * @param h - Run height in rows (1-24)
+ */
+static void writeColumnBits(Adafruit_SSD1306 *display, int16_t x, int16_t y, uint8_t h, uint32_t bits) {
+    int16_t width = display->width();
+    if (x < 0 || x >= width) return;
+    uint8_t shift = y & 7;
+    uint32_t mask = (((uint32_t)1 << h) - 1) << shift;
+    bits = (bits << shift) & mask;
+    uint8_t *dst = display->getBuffer() + (y >> 3) * width + x;
+    uint8_t pages = display->height() / 8 - (y >> 3);
+    for (uint8_t p = 0; p < pages && mask; p++, dst += width, mask >>= 8, bits >>= 8) {
+      *dst = (*dst & ~(uint8_t)mask) | (uint8_t)bits;
+    }
+}
+
+// ===== COMPRESSED IMAGE DECODER =====
+
+/**
+ * drawImage - Decode an RLE page-layout image (image_data.cpp) into the display buffer
+ *
+ * Streams the compressed bytes from PROGMEM straight into the buffer in page order,
+ * ORing like drawBitmap(..., 1). No scratch RAM: runs of zero only advance the write
+ * position, so blank areas cost one code byte and no buffer writes.
+ *
+ * @param x - Left column of the image
+ * @param page - Top page (row / 8) of the image
+ * @param img - Compressed image: width, pages, RLE stream
+ */
+void drawImage(Adafruit_SSD1306 *display, int16_t x, uint8_t page, const unsigned char *img) {
+    uint8_t *buffer = display->getBuffer();
+    int16_t width = display->width();
+    uint8_t pages = display->height() / 8;
+    uint8_t w = pgm_read_byte(img++);
+    uint8_t h = pgm_read_byte(img++);
+    uint8_t col = 0;
+    uint8_t p = 0;
+
+    while (p < h) {
+      uint8_t code = pgm_read_byte(img++);
+      uint8_t count;
+      uint8_t value = 0;
+      bool literal = false;
+      if (code < 0x80) {
+        count = code + 1;
+        literal = true;
+      } else if (code < 0xC0) {
+        count = (code & 0x3F) + 1;
+      } else {
+        count = (code & 0x3F) + 2;
+        value = pgm_read_byte(img++);
       }
-      dispBoost(&display1);  // Show boost with turbo icon, text only
-      break;
 
-    case 11:  // Oil Temperature Display              dispArray1 = {11, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag
+      while (count--) {
+        if (literal) value = pgm_read_byte(img++);
+        int16_t px = x + col;
+        if (value && px >= 0 && px < width && page + p < pages) {
+          buffer[(page + p) * width + px] |= value;
+        }
+        if (++col == w) {  // Runs may continue across a page boundary
+          col = 0;
+          p++;
+        }
       }
-      dispOilTempGfx(&display1);  // Show oil temp with oil can/thermometer icon
-      break;
+    }
+}
 
-    case 12:  // Fuel Composition Display             dispArray1 = {12, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag
+// ===== PANEL TABLE =====
+// Per-panel state below is indexed by panel: 0 = display1 (menu), 1.. = displays[1..].
+
+/**
+ * displayIndex - Panel index of a display object in displays[]
+ */
+static byte displayIndex(Adafruit_SSD1306 *display) {
+    for (byte i = 1; i < NUM_DISPLAYS; i++) {
+      if (display == &displays[i]) return i;
+    }
+    return 0;
+}
+
+/**
+ * screenModeChanged - Whether the screen a panel shows was just selected
+ * 
+ * Display 1 compares the whole menu position (dispArray1), the other panels their
+ * dispSelect entry. A change means the screen must redraw from scratch.
+ */
+static bool screenModeChanged(Adafruit_SSD1306 *display) {
+    byte idx = displayIndex(display);
+    if (idx == 0) {
+      return needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
+    }
+    return dispSelect[idx] != dispSelect_prev[idx];
+}
+
+// ===== SHARED FRAME BUFFER FLUSH =====
+// All panels render into frameBuffer; each keeps a checksum per 8-row page of what it last received.
+constexpr uint8_t FRAME_PAGES = SCREEN_H / 8;
+static uint16_t pageSums[NUM_DISPLAYS][FRAME_PAGES];  // Fletcher-16 sum per page, per panel
+static bool pageSumsValid[NUM_DISPLAYS];     // Panel contents unknown until the first flush
+static bool frameSent[NUM_DISPLAYS];         // A changed frame went out since the governor last looked
+static Adafruit_SSD1306 *frameOwner = NULL;  // Panel whose image the buffer currently holds
+static unsigned long spiBusyUs = 0;          // Time spent in panel transfers since the last stats report
+static unsigned int spiHoldMaxUs = 0;        // Longest single chunk (CAN's worst wait for the bus) since then
+static void auditFlush(byte panel, bool sent);  // Flush accounting and frame capture (below the registry)
+
+/**
+ * sendFrame - Send the frame buffer to this panel, yielding the bus to CAN between chunks
+ * 
+ * Same window and data as Adafruit_SSD1306::display(), but the data phase is split into
+ * OLED_CHUNK_BYTES transactions. The SSD1306 keeps its GDDRAM write pointer while
+ * deselected, so the transfer resumes where it stopped after canRxISR(), held off by
+ * each transaction, has read any frame the MCP2515 is holding. A CAN frame thus waits
+ * at most one chunk for the bus. Frames are only parsed by the main loop's serviceCAN(),
+ * so the values a screen just drew (and records as _prev) cannot change mid-flush.
+ */
+void SharedBufferSSD1306::sendFrame(void) {
+    static const uint8_t window[] = { SSD1306_PAGEADDR, 0, 0xFF, SSD1306_COLUMNADDR, 0, SCREEN_W - 1 };
+    for (uint8_t i = 0; i < sizeof(window); i++) {
+      ssd1306_command(window[i]);
+    }
+
+    const uint8_t *data = buffer;
+    uint16_t left = SCREEN_W * SCREEN_H / 8;
+    while (left > 0) {
+      uint8_t n = (left < OLED_CHUNK_BYTES) ? left : OLED_CHUNK_BYTES;
+      unsigned long start = micros();
+      SPI.beginTransaction(spiSettings);
+      digitalWrite(dcPin, HIGH);  // Data mode
+      digitalWrite(csPin, LOW);
+      for (uint8_t i = 0; i < n; i++) {
+        SPI.transfer(*data++);
       }
-      dispFuelComp(&display1);  // Show ethanol percentage (E85 flex fuel)
-      break;
+      digitalWrite(csPin, HIGH);
+      SPI.endTransaction();
+      unsigned long held = micros() - start;
+      spiBusyUs += held;
+      if (held > spiHoldMaxUs) spiHoldMaxUs = held;
+      left -= n;
+    }
+}
 
-    case 13:  // Injector Duty Cycle Display          dispArray1 = {13, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag
+/**
+ * flushDisplay - Send the shared frame buffer to a panel if it changed
+ * 
+ * Computes a position-sensitive checksum for each page of the buffer and compares it
+ * with the sums recorded at this panel's last flush. If every page matches, the SPI
+ * transfer is skipped (~130 µs of summing against ~1 ms of bus time). Otherwise the
+ * frame goes out through sendFrame(), which lets CAN in between chunks.
+ * 
+ * @param display - Panel the buffer was just rendered for (an entry of displays[])
+ */
+void flushDisplay(Adafruit_SSD1306 *display) {
+    byte idx = displayIndex(display);
+    const uint8_t *page = display->getBuffer();
+    bool changed = !pageSumsValid[idx];
+
+    for (uint8_t p = 0; p < FRAME_PAGES; p++) {
+      uint8_t a = 0, b = 0;  // Fletcher-16 (mod 256): b makes the sum position-sensitive
+      for (uint8_t col = 0; col < SCREEN_W; col++) {
+        a += *page++;
+        b += a;
       }
-      dispInjDuty(&display1);  // Show injector duty cycle percentage
-      break;
+      uint16_t sum = ((uint16_t)b << 8) | a;
+      if (sum != pageSums[idx][p]) {
+        pageSums[idx][p] = sum;
+        changed = true;
+      }
+    }
 
-    case 14:  // Ignition Timing Display              dispArray1 = {14, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag
+    frameOwner = display;
+    auditFlush(idx, changed);
+    if (changed) {
+      displays[idx].sendFrame();
+      pageSumsValid[idx] = true;
+      frameSent[idx] = true;
+    }
+}
+
+// ===== ICON SCREEN STATIC LAYER =====
+// Icon screens keep the icon (and any fixed label) in the buffer between value updates and
+// only clear the value field. The buffer is shared, so the layer survives only while the
+// same panel keeps rendering the same screen.
+static const unsigned char *layerIcon[NUM_DISPLAYS];  // Icon whose layer each panel last drew
+
+/**
+ * beginIconScreen - Prepare the buffer for an icon screen update
+ * 
+ * Full redraw (clear + icon) on a mode change, after another panel used the buffer,
+ * or if this panel last drew a different screen. Otherwise clears only columns
+ * fieldX0..fieldX1-1, one memset per page, leaving the icon in place.
+ * 
+ * @return true if the static layer was redrawn (caller adds its fixed labels)
+ */
+static bool beginIconScreen(Adafruit_SSD1306 *display, bool modeChanged, const unsigned char *icon,
+                            uint8_t fieldX0, uint8_t fieldX1) {
+    byte idx = displayIndex(display);
+    display->setTextColor(WHITE);
+    if (modeChanged || frameOwner != display || layerIcon[idx] != icon) {
+      display->clearDisplay();
+      drawImage(display, 0, 0, icon);
+      layerIcon[idx] = icon;
+      return true;
+    }
+    uint8_t *row = display->getBuffer();
+    for (uint8_t p = 0; p < FRAME_PAGES; p++, row += SCREEN_W) {
+      memset(row + fieldX0, 0, fieldX1 - fieldX0);
+    }
+    return false;
+}
+
+// ===== SCREEN REGISTRY =====
+// One entry per screen, in Display 1 menu order (index = dispArray1[0]). Displays 2 and up offer
+// the SCREEN_DISP2 entries in the same order (index = dispSelect[panel], saved in EEPROM), so
+// new screens must be appended to keep existing selections valid.
+// Refresh intervals: 33 ms incremental bar, 83 ms (12Hz) engine data, 143 ms (7Hz) vehicle
+// data, 500 ms (2Hz) slow sensors, 1000 ms static logo.
+static const ScreenDesc SCREENS[] PROGMEM = {
+  // render              interval  fault          displays
+  { dispSettings,        500,      FAULT_NONE,    SCREEN_DISP1 },                 //  0 Settings menu (always first)
+  { dispOilPrsGfx,       500,      FAULT_OIL,     SCREEN_DISP1 | SCREEN_DISP2 },  //  1 Oil Pressure
+  { dispCoolantTempGfx,  500,      FAULT_COOLANT, SCREEN_DISP1 | SCREEN_DISP2 },  //  2 Coolant Temp
+  { dispFuelLvlGfx,      500,      FAULT_FUEL,    SCREEN_DISP1 | SCREEN_DISP2 },  //  3 Fuel Level
+  { dispBattVoltGfx,     500,      FAULT_BATT,    SCREEN_DISP1 | SCREEN_DISP2 },  //  4 Battery Voltage
+  { dispRPM,             83,       FAULT_NONE,    SCREEN_DISP1 | SCREEN_DISP2 },  //  5 RPM
+  { dispSpd,             143,      FAULT_NONE,    SCREEN_DISP1 | SCREEN_DISP2 },  //  6 Speed
+  { dispAFR,             143,      FAULT_NONE,    SCREEN_DISP1 },                 //  7 AFR
+  { dispFuelPrs,         143,      FAULT_NONE,    SCREEN_DISP1 },                 //  8 Fuel Pressure
+  { dispBoostGfx,        33,       FAULT_NONE,    SCREEN_DISP1 | SCREEN_DISP2 },  //  9 Boost gauge with bar
+  { dispBoost,           83,       FAULT_NONE,    SCREEN_DISP1 | SCREEN_DISP2 },  // 10 Boost text
+  { dispOilTempGfx,      500,      FAULT_NONE,    SCREEN_DISP1 },                 // 11 Oil Temp
+  { dispFuelComp,        500,      FAULT_NONE,    SCREEN_DISP1 },                 // 12 Fuel Composition
+  { dispInjDuty,         143,      FAULT_NONE,    SCREEN_DISP1 },                 // 13 Injector Duty
+  { dispIgnAng,          143,      FAULT_NONE,    SCREEN_DISP1 },                 // 14 Ignition Timing
+  { dispTripOdo,         500,      FAULT_NONE,    SCREEN_DISP1 },                 // 15 Trip Odometer (reset submenu)
+  { dispClock,           500,      FAULT_NONE,    SCREEN_DISP1 | SCREEN_DISP2 },  // 16 Clock
+  { dispFalconScript,    1000,     FAULT_NONE,    SCREEN_DISP1 | SCREEN_DISP2 },  // 17 Falcon Script logo
+};
+constexpr byte SCREEN_TOTAL = sizeof(SCREENS) / sizeof(SCREENS[0]);
+constexpr byte SCREEN_TRIP_ODO = 15;  // Entry with its own reset submenu in dispMenu()
+
+/**
+ * registryIndex - Registry entry shown at a display menu position (SCREEN_TOTAL if none)
+ */
+static byte registryIndex(byte displayMode, byte displayNum) {
+  byte want = (displayNum == 1) ? SCREEN_DISP1 : SCREEN_DISP2;
+  for (byte i = 0; i < SCREEN_TOTAL; i++) {
+    if (pgm_read_byte(&SCREENS[i].displays) & want) {
+      if (displayMode == 0) return i;
+      displayMode--;
+    }
+  }
+  return SCREEN_TOTAL;
+}
+
+/**
+ * findScreen - Copy the registry entry shown at a display menu position
+ * @param displayMode - dispArray1[0] (displayNum 1) or dispSelect[displayNum - 1] (displayNum 2 and up)
+ * @return false if the position is out of range (e.g. corrupt EEPROM value)
+ */
+static bool findScreen(byte displayMode, byte displayNum, ScreenDesc *desc) {
+  byte i = registryIndex(displayMode, displayNum);
+  if (i >= SCREEN_TOTAL) return false;
+  memcpy_P(desc, &SCREENS[i], sizeof(ScreenDesc));
+  return true;
+}
+
+/**
+ * screenCount - Number of screens selectable on a display
+ */
+byte screenCount(byte displayNum) {
+  byte want = (displayNum == 1) ? SCREEN_DISP1 : SCREEN_DISP2;
+  byte n = 0;
+  for (byte i = 0; i < SCREEN_TOTAL; i++) {
+    if (pgm_read_byte(&SCREENS[i].displays) & want) n++;
+  }
+  return n;
+}
+
+/**
+ * panelScreen - Registry entry a panel is set to show (SCREEN_TOTAL if none)
+ */
+static byte panelScreen(byte panel) {
+  return (panel == 0) ? registryIndex(dispArray1[0], 1) : registryIndex(dispSelect[panel], panel + 1);
+}
+
+/**
+ * screenFault - Fault flags bound to the screen a panel shows
+ */
+byte screenFault(byte panel) {
+  byte i = panelScreen(panel);
+  return (i < SCREEN_TOTAL) ? pgm_read_byte(&SCREENS[i].fault) : FAULT_NONE;
+}
+
+/**
+ * panelSelectAddress - EEPROM address of a secondary panel's screen selection
+ * 
+ * Display 2 keeps its original address; displays 3 and up follow the timebase drift value.
+ */
+int panelSelectAddress(byte panel) {
+  return (panel == 1) ? dispSelectAddress : dispSelectExtraAddress + panel - 2;
+}
+
+// ===== FLUSH ACCOUNTING AND FRAME CAPTURE =====
+// Debug aids for display work: per-screen flush counts (DISPLAY_STATS) and a PBM dump of the
+// next frame sent to a panel. Serial commands "disp stats" and "disp dump <N>" drive them.
+constexpr unsigned int FLUSH_SPI_BYTES = 6 + SCREEN_W * SCREEN_H / 8;  // Address commands + one full frame
+
+struct FlushStats {
+  unsigned int sent;     // Frames transferred over SPI
+  unsigned int skipped;  // Flushes dropped because the frame matched what the panel shows
+};
+static FlushStats flushStats[SCREEN_TOTAL + 1];  // Indexed by registry entry; last slot = unknown
+static unsigned long flushStatsSince = 0;        // millis() of the last report
+static byte dumpPanel = 0;                       // Display number whose next flush is captured, 0 = none
+
+/**
+ * auditFlush - Count a flush against the screen on that panel, and capture it if requested
+ * @param panel - Panel index (0 = display1)
+ * @param sent - Frame differed from the panel's contents and is being transferred
+ */
+static void auditFlush(byte panel, bool sent) {
+  if (dumpPanel == panel + 1) {
+    // Plain PBM (P1), 1 = lit pixel: paste into a .pbm file to view or diff against a golden image
+    const uint8_t *buffer = frameBuffer;
+    Serial.println(F("P1"));
+    Serial.print(SCREEN_W);
+    Serial.print(' ');
+    Serial.println(SCREEN_H);
+    for (uint8_t y = 0; y < SCREEN_H; y++) {
+      const uint8_t *row = buffer + (y >> 3) * SCREEN_W;
+      uint8_t bit = 1 << (y & 7);
+      for (uint8_t x = 0; x < SCREEN_W; x++) {
+        Serial.write((row[x] & bit) ? '1' : '0');
       }
-      dispIgnAng(&display1);  // Show ignition advance in degrees BTDC
-      break;
+      Serial.println();
+    }
+    dumpPanel = 0;
+  }
+
+  if (DISPLAY_STATS) {
+    FlushStats *s = &flushStats[panelScreen(panel)];
+    if (sent) {
+      if (s->sent < 0xFFFF) s->sent++;
+    } else {
+      if (s->skipped < 0xFFFF) s->skipped++;
+    }
+  }
+}
+
+/**
+ * displayDumpNext - Print the next frame flushed to a panel as a PBM image on Serial
+ * @param panel - Display number, 1 to NUM_DISPLAYS
+ */
+void displayDumpNext(byte panel) {
+  dumpPanel = panel;
+}
+
+/**
+ * displayStatsReport - Print SPI bus utilisation and flush counts since the last report, then reset them
+ *
+ * Bus utilisation is the time all panels spent transferring frames, as tenths of a
+ * percent of the elapsed time; the longest chunk is the worst wait a pending CAN frame
+ * saw for the bus. With DISPLAY_STATS, one line per screen that flushed
+ * follows: registry index, frames sent, redundant frames skipped, SPI bytes sent, and
+ * sent frames per second. Redundant frames are work the screen's change detection
+ * could have avoided; sent bytes are the real bus load.
+ */
+void displayStatsReport(void) {
+  unsigned long now = millis();
+  unsigned long elapsed = now - flushStatsSince;
+  unsigned long busyPermille = elapsed ? spiBusyUs / elapsed : 0;  // µs per ms = 1/1000
+
+  Serial.print(F("spi busy us "));
+  Serial.print(spiBusyUs);
+  Serial.print(F(" over ms "));
+  Serial.print(elapsed);
+  Serial.print(F(" = "));
+  Serial.print(busyPermille / 10);
+  Serial.print('.');
+  Serial.print(busyPermille % 10);
+  Serial.println('%');
+  Serial.print(F("longest oled chunk us "));
+  Serial.println(spiHoldMaxUs);
+  spiBusyUs = 0;
+  spiHoldMaxUs = 0;
+  flushStatsSince = now;
+
+  if (!DISPLAY_STATS) {
+    Serial.println(F("disp stats: set DISPLAY_STATS in config_hardware.h for per-screen counts"));
+    return;
+  }
+  unsigned long totalBytes = 0;
+  Serial.println(F("screen sent skipped bytes fps/10"));
+  for (byte i = 0; i <= SCREEN_TOTAL; i++) {
+    FlushStats *s = &flushStats[i];
+    if (s->sent == 0 && s->skipped == 0) continue;
+    unsigned long bytes = (unsigned long)s->sent * FLUSH_SPI_BYTES;
+    totalBytes += bytes;
+    Serial.print(i);
+    Serial.print(' ');
+    Serial.print(s->sent);
+    Serial.print(' ');
+    Serial.print(s->skipped);
+    Serial.print(' ');
+    Serial.print(bytes);
+    Serial.print(' ');
+    Serial.println(elapsed ? (unsigned long)s->sent * 10000UL / elapsed : 0);
+    s->sent = 0;
+    s->skipped = 0;
+  }
+  Serial.print(F("total bytes "));
+  Serial.println(totalBytes);
+}
+
+/**
+ * dispPanelNumber - "DISPLAY n" header while choosing which panel to configure (NUM_DISPLAYS > 2)
+ */
+static void dispPanelNumber(Adafruit_SSD1306 *display, byte number) {
+    display->setTextColor(WHITE); 
+    display->clearDisplay();
+    display->setTextSize(2);
+    display->setCursor(10,8);  // Centered for "DISPLAY n" (9 chars * 12px = 108px, (128-108)/2 = 10)
+    display->print("DISPLAY ");
+    display->print(number);
+    flushDisplay(display);
+}
 
-    case 15:  // Trip Odometer with Reset Option      dispArray1 = {15, x, x, x}
+void dispMenu() {
+  bool forceDisplayUpdate = false;  // Flag to force display update after returning from submenu
+  
+  // Snapshot dispArray1[0] NOW, before the switch body runs.
+  // The rotate() ISR can fire mid-function (OLED SPI takes ~10-20 ms) and change
+  // dispArray1[0] to the *next* screen.  If we then write dispArray1_prev[0] with
+  // the new value, the next call sees modeChanged=false for the new screen while
+  // the hardware still shows old content — the "stuck screen" bug.
+  // By saving the value drawn here we ensure dispArray1_prev[0] always reflects
+  // what was actually rendered, not a later ISR update.
+  byte drawnScreen = dispArray1[0];
+  
+  switch (dispArray1[0]) {  // Level 0 - Main menu selection
+    
+    case SCREEN_TRIP_ODO:  // Trip Odometer with Reset Option  dispArray1 = {15, x, x, x}
 	  if (menuLevel == 0 && button == 1) {
         // Button pressed - enter submenu to confirm reset
         button = 0;
@@ -143,7 +666,7 @@ void dispMenu() {
                 // User confirmed reset
 			        odoTrip = 0;  // Clear trip odometer
 			        goToLevel0();  // Return to main menu
-			        dispArray1[0] = 15;  // Stay on trip odo screen
+			        dispArray1[0] = SCREEN_TRIP_ODO;  // Stay on trip odo screen
 			        forceDisplayUpdate = true;  // Flag for force update after for loop
             } 
             break;
@@ -153,7 +676,7 @@ void dispMenu() {
 			      if (button == 1) {
                 // User cancelled reset
 				      goToLevel0();  // Return to main menu
-				      dispArray1[0] = 15;  // Stay on trip odo screen
+				      dispArray1[0] = SCREEN_TRIP_ODO;  // Stay on trip odo screen
 				      forceDisplayUpdate = true;  // Flag for force update after for loop
 			      } 
           break;
@@ -161,20 +684,6 @@ void dispMenu() {
 	    }
       break;
 
-    case 16:  // Clock Display                        dispArray1 = {16, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        button = 0; // Clear button flag
-      }
-      dispClock(&display1);  // Show time from GPS with local offset
-      break;
-
-    case 17:  // Falcon Script Logo                   dispArray1 = {17, x, x, x}
-      if (menuLevel == 0 && button == 1) {
-        // No action on button press - just a splash screen
-      }
-      dispFalconScript(&display1);  // Display Falcon logo
-      break;
-
     case 0:  // SETTINGS MENU - Always last screen for easy wrapping access
              // Structure: Settings -> [Display 2 Select | Units | Clock Offset]
              //   -> Display 2: 10 screen options (0-9)
@@ -197,100 +706,47 @@ void dispMenu() {
         
         switch (dispArray1[1]) {  // Level 1 selection
           
-          case 0:  // Configure Display 2           dispArray1 = {0, 0, x, x}
+          case 0:  // Configure Display 2 (and up)  dispArray1 = {0, 0, x, x}
             if (menuLevel == 1 && button == 1) {
-              // Enter Display 2 selection submenu
+              // Enter Display 2 selection submenu; with more than two panels, level 2
+              // picks the panel (display 2 and up) and level 3 its screen
               button = 0;
               menuLevel = 2;   // Go to level 2
-              nMenuLevel = 9;  // 10 display options (0-indexed): 0-9
+              nMenuLevel = (NUM_DISPLAYS > 2) ? NUM_DISPLAYS - 2 : screenCount(2) - 1;  // Options (0-indexed)
               // Validate dispArray1[2] is in valid range (prevent EEPROM corruption issues)
-              if (dispArray1[2] > 9) {
+              if (dispArray1[2] > nMenuLevel) {
                 dispArray1[2] = 0;  // Reset to first option if out of range
-              }
-              // Force mode change detection so display updates immediately
-              dispArray1_prev[0] = 255;  // Set to invalid value to force update
-            } 
-            else if (menuLevel == 1) {
-              // Show "DISPLAY 2" menu header
-              //Serial.println("Display 2");  // Debug output
-              dispDisp2Select(&display1);
-            } 
-            else {
-              // Level 2 - Select what to show on Display 2
-              switch (dispArray1[2]) {
-                
-                case 0:  // Oil Pressure on Display 2    dispArray1 = {0, 0, 0, x}
-                  dispArray2[0] = 0;  // Set display 2 to oil pressure
-                  if (button == 1) {
-                    goToLevel0();  // Save and return to main menu
-                  }
-                  break;
-                  
-                case 1:  // Coolant Temp on Display 2    dispArray1 = {0, 0, 1, x}
-                  dispArray2[0] = 1;  // Set display 2 to coolant temp
-                  if (button == 1) {
-                    goToLevel0();  // Save and return to main menu
-                  }
-                  break;
-                  
-                case 2:  // Fuel Level on Display 2      dispArray1 = {0, 0, 2, x}
-                  dispArray2[0] = 2;  // Set display 2 to fuel level
-                  if (button == 1) {
-                    goToLevel0();  // Save and return to main menu
-                  }
-                  break;
-                  
-                case 3:  // Battery Voltage on Display 2 dispArray1 = {0, 0, 3, x}
-                  dispArray2[0] = 3;  // Set display 2 to battery voltage
-                  if (button == 1) {
-                    goToLevel0();  // Save and return to main menu
-                  }
-                  break;
-                  
-                case 4:  // RPM on Display 2             dispArray1 = {0, 0, 4, x}
-                  dispArray2[0] = 4;  // Set display 2 to RPM
-                  if (button == 1) {
-                    goToLevel0();  // Save and return to main menu
-                  }
-                  break;
-                  
-                case 5:  // Speed on Display 2           dispArray1 = {0, 0, 5, x}
-                  dispArray2[0] = 5;  // Set display 2 to speed
-                  if (button == 1) {
-                    goToLevel0();  // Save and return to main menu
-                  }
-                  break;
-
-                case 6:  // Boost Gauge on Display 2 (with bar)  dispArray1 = {0, 0, 6, x}
-                  dispArray2[0] = 6;  // Set display 2 to boost gauge with bar
-                  if (button == 1) {
-                    goToLevel0();  // Save and return to main menu
-                  }
-                  break;
-
-                case 7:  // Boost Display on Display 2 (text)    dispArray1 = {0, 0, 7, x}
-                  dispArray2[0] = 7;  // Set display 2 to boost text display
-                  if (button == 1) {
-                    goToLevel0();  // Save and return to main menu
-                  }
-                  break;
-
-                case 8:  // Clock on Display 2           dispArray1 = {0, 0, 8, x}
-                  dispArray2[0] = 8;  // Set display 2 to clock
-                  if (button == 1) {
-                    goToLevel0();  // Save and return to main menu
-                  }
-                  break;
-                  
-                case 9:  // Falcon Script on Display 2   dispArray1 = {0, 0, 9, x}
-                  dispArray2[0] = 9;  // Set display 2 to Falcon logo
-                  if (button == 1) {
-                    goToLevel0();  // Save and return to main menu
-                  }
-                  break;
-                
-              } // End switch dispArray1[2] - Display 2 options
-            } // End level 2 - Display 2 selection
+              }
+              // Force mode change detection so display updates immediately
+              dispArray1_prev[0] = 255;  // Set to invalid value to force update
+            } 
+            else if (menuLevel == 1) {
+              // Show "DISPLAY 2" menu header
+              //Serial.println("Display 2");  // Debug output
+              dispDisp2Select(&display1);
+            } 
+            else if (NUM_DISPLAYS > 2 && menuLevel == 2) {
+              if (button == 1) {
+                // Enter screen selection for the chosen panel
+                button = 0;
+                menuLevel = 3;   // Go to level 3
+                nMenuLevel = screenCount(2) - 1;
+                if (dispArray1[3] > nMenuLevel) {
+                  dispArray1[3] = 0;  // Reset to first option if out of range
+                }
+                dispArray1_prev[0] = 255;  // Force mode change detection
+              } else {
+                dispPanelNumber(&display1, dispArray1[2] + 2);  // "DISPLAY n" for the highlighted panel
+              }
+            }
+            else {
+              // Last level - Select what that panel shows (registry order, see SCREENS)
+              byte panel = (NUM_DISPLAYS > 2) ? dispArray1[2] + 1 : 1;
+              dispSelect[panel] = dispArray1[menuLevel];
+              if (button == 1) {
+                goToLevel0();  // Save and return to main menu
+              }
+            } // End last level - panel screen selection
             break;  // End case 0 - Display 2 submenu
  
           case 1:  // Configure Units (Metric/Imperial)  dispArray1 = {0, 1, x, x}
@@ -321,7 +777,7 @@ void dispMenu() {
                   display1.setTextSize(2);
                   display1.setCursor(31,8);
                   display1.println("Metric");  // Display selected unit system
-                  display1.display();
+                  flushDisplay(&display1);
                   units = 0;  // Set to metric
                   if (button == 1) {
                     goToLevel0();  // Save and return to main menu
@@ -334,7 +790,7 @@ void dispMenu() {
                   display1.setTextSize(2);
                   display1.setCursor(20,8);
                   display1.println("'Merican");  // Display selected unit system
-                  display1.display();
+                  flushDisplay(&display1);
                   units = 1;  // Set to imperial
                   if (button == 1) {
                     goToLevel0();  // Save and return to main menu
@@ -391,7 +847,7 @@ void dispMenu() {
             display1.setTextSize(2);
             display1.setCursor(35,8);
             display1.println("EXIT");  // Display "EXIT" text               
-            display1.display();
+            flushDisplay(&display1);
             if (button == 1) {
               goToLevel0();  // Return to main menu
             }
@@ -400,6 +856,19 @@ void dispMenu() {
         } // End switch dispArray1[1] - Settings level 1 options
         break;  // Break for case 0 (Settings menu when in submenus)
       } // End Settings submenu levels 1-3
+      break;
+
+    default:  // Display-only screens: dispatch through the screen registry
+      if (menuLevel == 0 && button == 1) {
+        button = 0; // Clear button flag (no action - this is a display screen only)
+      }
+      {
+        ScreenDesc desc;
+        if (findScreen(dispArray1[0], 1, &desc)) {
+          desc.render(&display1);
+        }
+      }
+      break;
   } // End switch dispArray1[0] - Main menu selection
   
   // Update previous display mode for dirty tracking.
@@ -418,10 +887,11 @@ void dispMenu() {
 } // End dispMenu()
 
 /**
- * disp2 - Control display 2 based on saved selection
+ * dispPanel - Control a secondary panel (display 2 and up) based on its saved selection
  * 
- * Routes display 2 output based on dispArray2[0], which is set in Settings menu
- * and saved to EEPROM. Allows user to customize what appears on the second display.
+ * Routes the panel's output based on dispSelect[panel], which is set in the Settings menu
+ * and saved to EEPROM. Allows user to customize what appears on the other displays.
+ * dispSelect[panel] indexes the SCREEN_DISP2 entries of the screen registry.
  * 
  * Display options:
  * 0 - Oil Pressure
@@ -434,53 +904,17 @@ void dispMenu() {
  * 7 - Boost Display (text only)
  * 8 - Clock
  * 9 - Falcon Script logo
+ * 
+ * @param panel - Panel index, 1 to NUM_DISPLAYS - 1
  */
-void disp2(void){
-  switch (dispArray2[0]){
-
-    case 0: // Oil Pressure
-      dispOilPrsGfx(&display2);
-      break;
-    
-    case 1: // Coolant Temp
-      dispCoolantTempGfx(&display2);
-      break;
-
-    case 2: // Fuel Level
-      dispFuelLvlGfx(&display2);
-      break;
-
-    case 3: // Battery Voltage
-      dispBattVoltGfx(&display2);
-      break;
-
-    case 4: // RPM
-      dispRPM(&display2);
-      break;
-
-    case 5: // Speed
-      dispSpd(&display2);
-      break;
-
-    case 6: // Boost Gauge (with bar)
-      dispBoostGfx(&display2);  // Show boost with turbo icon and bar gauge
-      break;
-
-    case 7: // Boost Display (text only)
-      dispBoost(&display2);  // Show boost with turbo icon, text only
-      break;
-
-    case 8: // Clock
-      dispClock(&display2);
-      break;
-
-    case 9: // Falcon Script Logo
-      dispFalconScript(&display2);
-      break;
+static void dispPanel(byte panel) {
+  ScreenDesc desc;
+  if (findScreen(dispSelect[panel], panel + 1, &desc)) {
+    desc.render(&displays[panel]);
   }
   
-  // Update previous display mode for dirty tracking
-  dispArray2_prev = dispArray2[0];
+  // Update previous selection for dirty tracking
+  dispSelect_prev[panel] = dispSelect[panel];
 }
 
 void dispSettings (Adafruit_SSD1306 *display) {
@@ -490,7 +924,7 @@ void dispSettings (Adafruit_SSD1306 *display) {
     display->setCursor(16,8);  // Centered for "SETTINGS" (8 chars * 12px = 96px, (128-96)/2 = 16)
     display->println("SETTINGS");
     display->drawRect(0,0,128,32,SSD1306_WHITE);  // Draw border rectangle              
-    display->display();
+    flushDisplay(display);
 }
 
 /**
@@ -501,9 +935,14 @@ void dispDisp2Select (Adafruit_SSD1306 *display) {
     display->setTextColor(WHITE); 
     display->clearDisplay();
     display->setTextSize(2);
-    display->setCursor(10,8);  // Centered for "DISPLAY 2" (9 chars * 12px = 108px, (128-108)/2 = 10)
-    display->println("DISPLAY 2");                 
-    display->display();
+    if (NUM_DISPLAYS > 2) {
+      display->setCursor(16,8);  // Centered for "DISPLAYS" (8 chars * 12px = 96px, (128-96)/2 = 16)
+      display->println("DISPLAYS");
+    } else {
+      display->setCursor(10,8);  // Centered for "DISPLAY 2" (9 chars * 12px = 108px, (128-108)/2 = 10)
+      display->println("DISPLAY 2");
+    }                 
+    flushDisplay(display);
 }
 
 /**
@@ -516,7 +955,7 @@ void dispUnits (Adafruit_SSD1306 *display) {
     display->setTextSize(2);
     display->setCursor(34,8);  // Centered for "UNITS" (5 chars * 12px = 60px, (128-60)/2 = 34)
     display->println("UNITS");                 
-    display->display();
+    flushDisplay(display);
 }
 
 /**
@@ -529,31 +968,22 @@ void dispClockOffset (Adafruit_SSD1306 *display) {
     display->setTextSize(2);
     display->setCursor(10,9);  // Centered for "SET CLOCK" (9 chars * 12px = 108px, (128-108)/2 = 10)
     display->println("SET CLOCK");                 
-    display->display();
+    flushDisplay(display);
 }
 
 void dispRPM (Adafruit_SSD1306 *display){
     // Check if mode changed or RPM changed enough to warrant update
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-    }
+    bool modeChanged = screenModeChanged(display);
     
     // Only update if mode changed or value changed significantly
     if (modeChanged || needsUpdate_RPM(RPM, RPM_prev)) {
-      byte nDig = digits(RPM);  // Calculate number of digits for centering
-      byte center = 47;         // Center point for display
       display->setTextColor(WHITE); 
       display->clearDisplay();
-      display->setTextSize(3);  // Large text for main value
-      display->setCursor(center-((nDig*18)/2),6);  // Center based on digits (18 pixels per char at size 3)
-      display->println(RPM); 
+      int16_t x = drawBigNumber(display, 47, 6, RPM, 0, ALIGN_CENTER);  // Large main value, centered on x=47
       display->setTextSize(2);  // Smaller text for label
-      display->setCursor(center+((nDig*18)/2)+4,10);  // Position just right of number (matches dispSpd pattern)
+      display->setCursor(x+4,10);  // Position just right of number (matches dispSpd pattern)
       display->println("RPM");                
-      display->display();
+      flushDisplay(display);
       
       // Update previous value
       RPM_prev = RPM;
@@ -567,20 +997,15 @@ void dispRPM (Adafruit_SSD1306 *display){
  * Metric: km/h (from GPS data)
  * Imperial: mph (converted from km/h)
  * 
- * Uses dynamic centering based on number of digits.
+ * Centered on the formatted text width.
  * 
- * @param display - Pointer to display object (display1 or display2)
+ * @param display - Pointer to display object (an entry of displays[])
  * 
  * Note: spd is stored as km/h * 100 for integer precision
  */
 void dispSpd (Adafruit_SSD1306 *display){
     // Check if mode changed or speed changed enough to warrant update
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-    }
+    bool modeChanged = screenModeChanged(display);
     
     // Only update if mode changed or value changed significantly
     if (modeChanged || needsUpdate_Speed(spd, spd_prev)) {
@@ -588,30 +1013,22 @@ void dispSpd (Adafruit_SSD1306 *display){
       display->clearDisplay();
 
       if (units == 0){    // Metric Units (km/h)
-        float spdDisp = spd*0.01;  // Convert from km/h*100 to km/h
-        byte nDig = digits(spdDisp);  // Get number of digits for centering
-        byte center = 37;
-        display->setTextSize(3);  // Large text for speed value (18 pixels per character)
-        display->setCursor(center-((nDig*18)/2),6);
-        display->print(spdDisp, 0);  // Print without decimal places
-        display->setCursor(center+((nDig*18)/2)+4,10);
+        long spdDisp = displayValue(speedTenths(spd), CONV_NONE, 0);
+        int16_t x = drawBigNumber(display, 37, 6, spdDisp, 0, ALIGN_CENTER);  // Large speed value (18 pixels per character)
+        display->setCursor(x+4,10);
         display->setTextSize(2);  // Smaller text for units
         display->println("km/h");
                  
       } 
       else {              // Imperial Units (mph)
-        float spdDisp = spd * 0.006213711922;  // Convert km/h*100 to mph (factor = 0.6213712 / 100)
-        byte nDig = digits (spdDisp);
-        byte center = 47;
-        display->setTextSize(3);
-        display->setCursor(center-((nDig*18)/2),6);
-        display->print(spdDisp, 0);  // Print without decimal places
-        display->setCursor(center+((nDig*18)/2)+4,10);
+        long spdDisp = displayValue(speedTenths(spd), CONV_KM_TO_MI, 0);
+        int16_t x = drawBigNumber(display, 47, 6, spdDisp, 0, ALIGN_CENTER);  // Print without decimal places
+        display->setCursor(x+4,10);
         display->setTextSize(2);
         display->println("MPH");          
       }
             
-      display->display();
+      flushDisplay(display);
       
       // Update previous value
       spd_prev = spd;
@@ -631,44 +1048,16 @@ void dispSpd (Adafruit_SSD1306 *display){
  */
 void dispOilTemp (Adafruit_SSD1306 *display) {
     // Check if mode changed or temperature changed enough to warrant update
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-    }
+    bool modeChanged = screenModeChanged(display);
     
     // Only update if mode changed or value changed significantly
     if (modeChanged || needsUpdate_Temperature(oilTemp, oilTemp_prev)) {
-      float oilTempDisp;
       display->setTextColor(WHITE); 
       display->clearDisplay();
-      display->drawBitmap(0, 0, IMG_OIL_TEMP, 40, 32, 1);  // Draw oil/temp icon (40x32 pixels)
-      byte center = 71;  // Center point for text (offset for icon on left)
-      
-      if (units == 0){    // Metric Units (Celsius)
-        oilTempDisp = oilTemp;  // No conversion needed - already in Celsius
-        byte nDig = digits (oilTempDisp);
-        display->setTextSize(3); 
-        display->setCursor(center-((nDig*18)/2),6);
-        display->print(oilTempDisp, 0);  // Print temperature value
-        display->drawCircle(center+((nDig*18)/2)+3, 7, 2, WHITE);  // Draw degree symbol (small circle)
-        display->setCursor(center+((nDig*18)/2)+9,6);
-        display->println("C");  // Celsius label
-      }
-
-      else {              // Imperial Units (Fahrenheit)
-        oilTempDisp = (oilTemp*1.8) + 32;  // Convert Celsius to Fahrenheit
-        byte nDig = digits (oilTempDisp);
-        display->setTextSize(3); 
-        display->setCursor(center-((nDig*18)/2),6);
-        display->print(oilTempDisp, 0);
-        display->drawCircle(center+((nDig*18)/2)+3, 7, 2, WHITE);  // Draw degree symbol
-        display->setCursor(center+((nDig*18)/2)+9,6);
-        display->println("F");  // Fahrenheit label
-      }
+      drawImage(display, 0, 0, IMG_OIL_TEMP);  // Draw oil/temp icon (40x32 pixels)
+      drawTemperature(display, 71, oilTemp);   // Centered right of the icon, with degree symbol and unit
 
-      display->display();
+      flushDisplay(display);
       
       // Update previous value
       oilTemp_prev = oilTemp;
@@ -690,16 +1079,10 @@ void dispOilTemp (Adafruit_SSD1306 *display) {
  */
 void dispFuelPrs (Adafruit_SSD1306 *display) {
     // Check if mode changed or fuel pressure changed enough to warrant update
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-    }
+    bool modeChanged = screenModeChanged(display);
     
     // Only update if mode changed or value changed significantly
     if (modeChanged || needsUpdate_Pressure(fuelPrs, fuelPrs_prev, units)) {
-      float fuelPrsDisp;
       display->setTextColor(WHITE); 
       display->clearDisplay();
       display->setTextSize(2); 
@@ -709,33 +1092,9 @@ void dispFuelPrs (Adafruit_SSD1306 *display) {
       display->setCursor(0,21);
       display->println("PRESSURE");  // Label line 2
 
-      if (units == 0){    // Metric Units (bar)
-        fuelPrsDisp = fuelPrs/100;  // Convert kPa to bar (1 bar = 100 kPa)
-        if (fuelPrsDisp < 0) {fuelPrsDisp = 0;}  // Clamp to 0 if negative
-        byte nDig = 3;  // Always 3 digits for bar (e.g., "3.5")
-        byte center = 79;
-        display->setTextSize(3);
-        display->setCursor(center-((nDig*18)/2),6);
-        display->print(fuelPrsDisp, 1);  // Print with 1 decimal place
-        display->setCursor(center+((nDig*18)/2)+3,18);
-        display->setTextSize(1); 
-        display->println("bar");
-                 
-      } 
-      else {              // Imperial Units (PSI)
-        fuelPrsDisp = fuelPrs * 0.1450377;  // Convert kPa to PSI (1 kPa = 0.145 PSI)
-        if (fuelPrsDisp < 0) {fuelPrsDisp = 0;}  // Clamp to 0 if negative
-        byte nDig = digits (fuelPrsDisp);
-        byte center = 71;
-        display->setTextSize(3);
-        display->setCursor(center-((nDig*18)/2),6);
-        display->print(fuelPrsDisp, 0);  // Print without decimal
-        display->setCursor(center+((nDig*18)/2)+2,10);
-        display->setTextSize(2);
-        display->println("PSI");          
-      }
+      drawPressure(display, fuelPrs);  // Clamped at 0 (sensor error or not connected)
       
-      display->display();
+      flushDisplay(display);
       
       // Update previous value
       fuelPrs_prev = fuelPrs;
@@ -754,17 +1113,10 @@ void dispFuelPrs (Adafruit_SSD1306 *display) {
  */
 void dispFuelComp (Adafruit_SSD1306 *display) {
     // Check if mode changed or fuel composition changed enough to warrant update
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-    }
+    bool modeChanged = screenModeChanged(display);
     
     // Redraw when the displayed value (0 decimal places) has changed
-    if (modeChanged || (int)roundf(fuelComp) != (int)roundf(fuelComp_prev)) {
-      byte nDig = digits (fuelComp);
-      byte center = 79;
+    if (modeChanged || displayValue(toTenths(fuelComp), CONV_NONE, 0) != displayValue(toTenths(fuelComp_prev), CONV_NONE, 0)) {
       display->setTextColor(WHITE); 
       display->clearDisplay();
       display->setTextSize(2);
@@ -772,11 +1124,9 @@ void dispFuelComp (Adafruit_SSD1306 *display) {
       display->println("Flex");  // Label line 1
       display->setCursor(2,15);
       display->println("Fuel");  // Label line 2
-      display->setTextSize(3); 
-      display->setCursor(center-((nDig*18)/2),6);
-      display->print(fuelComp, 0);  // Print percentage value
-      display->println("%");        
-      display->display();
+      int16_t x = drawBigNumber(display, 79, 6, displayValue(toTenths(fuelComp), CONV_NONE, 0), 0, ALIGN_CENTER);
+      drawBigText(display, x, 6, "%");
+      flushDisplay(display);
       
       // Update previous value
       fuelComp_prev = fuelComp;
@@ -793,24 +1143,17 @@ void dispFuelComp (Adafruit_SSD1306 *display) {
  */
 void dispAFR (Adafruit_SSD1306 *display) {
     // Check if mode changed or AFR changed enough to warrant update
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-    }
+    bool modeChanged = screenModeChanged(display);
     
     // Redraw when the displayed value (1 decimal place) has changed
-    if (modeChanged || (int)roundf(afr * 10.0f) != (int)roundf(afr_prev * 10.0f)) {
+    if (modeChanged || toTenths(afr) != toTenths(afr_prev)) {
       display->setTextColor(WHITE); 
       display->clearDisplay();
-      display->setCursor(8,6);
-      display->setTextSize(3); 
-      display->print(afr, 1);  // Print AFR with 1 decimal place (e.g., 14.7)
+      drawBigNumber(display, 8, 6, toTenths(afr), 1);  // Print AFR with 1 decimal place (e.g., 14.7)
       display->setCursor(88,10);
       display->setTextSize(2);
       display->println("AFR");         
-      display->display();
+      flushDisplay(display);
       
       // Update previous value
       afr_prev = afr;
@@ -824,32 +1167,18 @@ void dispAFR (Adafruit_SSD1306 *display) {
  */
 void dispFalconScript(Adafruit_SSD1306 *display) {
     // Check if display mode changed (need to redraw)
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-      if (modeChanged) {
-        staticContentDrawn1 = false;
-      }
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-      if (modeChanged) {
-        staticContentDrawn2 = false;
-      }
+    byte idx = displayIndex(display);
+    if (screenModeChanged(display)) {
+      staticContentDrawn[idx] = false;
     }
     
     // Only draw if not already drawn (static content optimization)
-    if ((display == &display1 && !staticContentDrawn1) || 
-        (display == &display2 && !staticContentDrawn2)) {
+    if (!staticContentDrawn[idx]) {
       display->clearDisplay();
-      display->drawBitmap(0, 0, IMG_FALCON_SCRIPT, SCREEN_W, SCREEN_H, 1);
-      display->display();
+      drawImage(display, 0, 0, IMG_FALCON_SCRIPT);
+      flushDisplay(display);
       
-      // Mark static content as drawn
-      if (display == &display1) {
-        staticContentDrawn1 = true;
-      } else {
-        staticContentDrawn2 = true;
-      }
+      staticContentDrawn[idx] = true;  // Mark static content as drawn
     }
 }
 
@@ -860,32 +1189,18 @@ void dispFalconScript(Adafruit_SSD1306 *display) {
  */
 void disp302CID(Adafruit_SSD1306 *display) {
     // Check if display mode changed (need to redraw)
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-      if (modeChanged) {
-        staticContentDrawn1 = false;
-      }
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-      if (modeChanged) {
-        staticContentDrawn2 = false;
-      }
+    byte idx = displayIndex(display);
+    if (screenModeChanged(display)) {
+      staticContentDrawn[idx] = false;
     }
     
     // Only draw if not already drawn (static content optimization)
-    if ((display == &display1 && !staticContentDrawn1) || 
-        (display == &display2 && !staticContentDrawn2)) {
+    if (!staticContentDrawn[idx]) {
       display->clearDisplay();
-      display->drawBitmap(0, 0, IMG_302_CID, SCREEN_W, SCREEN_H, 1);
-      display->display();
+      drawImage(display, 0, 0, IMG_302_CID);
+      flushDisplay(display);
       
-      // Mark static content as drawn
-      if (display == &display1) {
-        staticContentDrawn1 = true;
-      } else {
-        staticContentDrawn2 = true;
-      }
+      staticContentDrawn[idx] = true;  // Mark static content as drawn
     }
 }
 
@@ -896,32 +1211,18 @@ void disp302CID(Adafruit_SSD1306 *display) {
  */
 void disp2300turbo(Adafruit_SSD1306 *display) {
     // Check if display mode changed (need to redraw)
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-      if (modeChanged) {
-        staticContentDrawn1 = false;
-      }
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-      if (modeChanged) {
-        staticContentDrawn2 = false;
-      }
+    byte idx = displayIndex(display);
+    if (screenModeChanged(display)) {
+      staticContentDrawn[idx] = false;
     }
     
     // Only draw if not already drawn (static content optimization)
-    if ((display == &display1 && !staticContentDrawn1) || 
-        (display == &display2 && !staticContentDrawn2)) {
+    if (!staticContentDrawn[idx]) {
       display->clearDisplay();
-      display->drawBitmap(0, 0, IMG_2300_TURBO, SCREEN_W, SCREEN_H, 1);
-      display->display();
+      drawImage(display, 0, 0, IMG_2300_TURBO);
+      flushDisplay(display);
       
-      // Mark static content as drawn
-      if (display == &display1) {
-        staticContentDrawn1 = true;
-      } else {
-        staticContentDrawn2 = true;
-      }
+      staticContentDrawn[idx] = true;  // Mark static content as drawn
     }
 }
 
@@ -932,32 +1233,18 @@ void disp2300turbo(Adafruit_SSD1306 *display) {
  */
 void disp302V(Adafruit_SSD1306 *display) {
     // Check if display mode changed (need to redraw)
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-      if (modeChanged) {
-        staticContentDrawn1 = false;
-      }
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-      if (modeChanged) {
-        staticContentDrawn2 = false;
-      }
+    byte idx = displayIndex(display);
+    if (screenModeChanged(display)) {
+      staticContentDrawn[idx] = false;
     }
     
     // Only draw if not already drawn (static content optimization)
-    if ((display == &display1 && !staticContentDrawn1) || 
-        (display == &display2 && !staticContentDrawn2)) {
+    if (!staticContentDrawn[idx]) {
       display->clearDisplay();
-      display->drawBitmap(0, 0, IMG_302V, SCREEN_W, SCREEN_H, 1);
-      display->display();
+      drawImage(display, 0, 0, IMG_302V);
+      flushDisplay(display);
       
-      // Mark static content as drawn
-      if (display == &display1) {
-        staticContentDrawn1 = true;
-      } else {
-        staticContentDrawn2 = true;
-      }
+      staticContentDrawn[idx] = true;  // Mark static content as drawn
     }
 }
 
@@ -976,45 +1263,14 @@ void disp302V(Adafruit_SSD1306 *display) {
  */
 void dispOilPrsGfx (Adafruit_SSD1306 *display) {
     // Check if mode changed or pressure changed enough to warrant update
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-    }
+    bool modeChanged = screenModeChanged(display);
     
     // Only update if mode changed or value changed significantly
     if (modeChanged || needsUpdate_Pressure(oilPrs, oilPrs_prev, units)) {
-      float oilPrsDisp;
-      display->setTextColor(WHITE); 
-      display->clearDisplay();
-      display->drawBitmap(0, 0, IMG_OIL_PRS, 40, 32, 1);  // Draw oil can icon
-      
-      if (units == 0){    // Metric Units (bar)
-        oilPrsDisp = (oilPrs < 0) ? 0 : oilPrs/100;  // Convert kPa to bar, clamp negative
-        byte nDig = 3;  // Always 3 digits for bar
-        byte center = 79;
-        display->setTextSize(3);
-        display->setCursor(center-((nDig*18)/2),6);
-        display->print(oilPrsDisp, 1);  // Print with 1 decimal
-        display->setCursor(center+((nDig*18)/2)+3,18);
-        display->setTextSize(1); 
-        display->println("bar");
-                 
-      } 
-      else {              // Imperial Units (PSI)
-        oilPrsDisp = (oilPrs < 0) ? 0 : oilPrs * 0.1450377;  // Convert kPa to PSI, clamp negative
-        byte nDig = digits (oilPrsDisp);
-        byte center = 71;
-        display->setTextSize(3); // char width = 18
-        display->setCursor(center-((nDig*18)/2),6);
-        display->print(oilPrsDisp, 0);  
-        display->setCursor(center+((nDig*18)/2)+2,10);
-        display->setTextSize(2);
-        display->println("PSI");          
-      }
+      beginIconScreen(display, modeChanged, IMG_OIL_PRS, 40, SCREEN_W);  // Oil can icon, value field right of it
+      drawPressure(display, oilPrs);
             
-      display->display();
+      flushDisplay(display);
       
       // Update previous value
       oilPrs_prev = oilPrs;
@@ -1023,44 +1279,14 @@ void dispOilPrsGfx (Adafruit_SSD1306 *display) {
 
 void dispOilTempGfx (Adafruit_SSD1306 *display) {
     // Check if mode changed or temperature changed enough to warrant update
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-    }
+    bool modeChanged = screenModeChanged(display);
     
     // Only update if mode changed or value changed significantly
     if (modeChanged || needsUpdate_Temperature(oilTemp, oilTemp_prev)) {
-      float oilTempDisp;
-      display->setTextColor(WHITE); 
-      display->clearDisplay();             //clear buffer
-      display->drawBitmap(0, 0, IMG_OIL_TEMP, 40, 32, 1);
-      byte center = 71;
-      
-      if (units == 0){    // Metric Units
-        oilTempDisp = oilTemp;
-        byte nDig = digits (oilTempDisp);
-        display->setTextSize(3); 
-        display->setCursor(center-((nDig*18)/2),6);
-        display->print(oilTempDisp, 0);
-        display->drawCircle(center+((nDig*18)/2)+3, 7, 2, WHITE);
-        display->setCursor(center+((nDig*18)/2)+9,6);
-        display->println("C");
-      }
-
-      else {              // 'Merican Units
-        oilTempDisp = (oilTemp*1.8) + 32; // convert C to F
-        byte nDig = digits (oilTempDisp);
-        display->setTextSize(3); 
-        display->setCursor(center-((nDig*18)/2),6);
-        display->print(oilTempDisp, 0);
-        display->drawCircle(center+((nDig*18)/2)+3, 7, 2, WHITE);
-        display->setCursor(center+((nDig*18)/2)+9,6);
-        display->println("F");
-      }
+      beginIconScreen(display, modeChanged, IMG_OIL_TEMP, 40, SCREEN_W);
+      drawTemperature(display, 71, oilTemp);
 
-      display->display();
+      flushDisplay(display);
       
       // Update previous value
       oilTemp_prev = oilTemp;
@@ -1069,44 +1295,14 @@ void dispOilTempGfx (Adafruit_SSD1306 *display) {
 
 void dispCoolantTempGfx (Adafruit_SSD1306 *display) {
     // Check if mode changed or temperature changed enough to warrant update
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-    }
+    bool modeChanged = screenModeChanged(display);
     
     // Only update if mode changed or value changed significantly
     if (modeChanged || needsUpdate_Temperature(coolantTemp, coolantTemp_prev)) {
-      float coolantTempDisp;
-      display->setTextColor(WHITE); 
-      display->clearDisplay();             //clear buffer
-      display->drawBitmap(0, 0, IMG_COOLANT_TEMP, 38, 32, 1);
-      byte center = 71;
-      
-      if (units == 0){    // Metric Units
-        coolantTempDisp = coolantTemp;
-        byte nDig = digits (coolantTempDisp);
-        display->setTextSize(3); 
-        display->setCursor(center-((nDig*18)/2),6);
-        display->print(coolantTempDisp, 0);
-        display->drawCircle(center+((nDig*18)/2)+3, 7, 2, WHITE);
-        display->setCursor(center+((nDig*18)/2)+9,6);
-        display->println("C");
-      }
-
-      else {              // 'Merican Units
-        coolantTempDisp = (coolantTemp*1.8) + 32; // convert C to F
-        byte nDig = digits (coolantTempDisp);
-        display->setTextSize(3); 
-        display->setCursor(center-((nDig*18)/2),6);
-        display->print(coolantTempDisp, 0);
-        display->drawCircle(center+((nDig*18)/2)+3, 7, 2, WHITE);
-        display->setCursor(center+((nDig*18)/2)+9,6);
-        display->println("F");
-      }
+      beginIconScreen(display, modeChanged, IMG_COOLANT_TEMP, 38, SCREEN_W);
+      drawTemperature(display, 71, coolantTemp);
 
-      display->display();
+      flushDisplay(display);
       
       // Update previous value
       coolantTemp_prev = coolantTemp;
@@ -1115,25 +1311,17 @@ void dispCoolantTempGfx (Adafruit_SSD1306 *display) {
 
 void dispBattVoltGfx (Adafruit_SSD1306 *display) {
     // Check if mode changed or battery voltage changed enough to warrant update
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-    }
+    bool modeChanged = screenModeChanged(display);
     
     // Redraw when the displayed value (1 decimal place) has changed
-    if (modeChanged || (int)roundf(vBatt * 10) != (int)roundf(vBatt_prev * 10)) {
-      display->setTextColor(WHITE); 
-      display->clearDisplay();             //clear buffer
-      display->drawBitmap(0, 0, IMG_BATT_VOLT, 35, 32, 1);
-      display->setTextSize(3); 
-      display->setCursor(42,6);
-      display->println(vBatt, 1);
-      display->setTextSize(2);
-      display->setCursor(116,12); 
-      display->println("V");         
-      display->display();
+    if (modeChanged || toTenths(vBatt) != toTenths(vBatt_prev)) {
+      if (beginIconScreen(display, modeChanged, IMG_BATT_VOLT, 35, 116)) {
+        display->setTextSize(2);  // Fixed "V" label is part of the static layer
+        display->setCursor(116,12); 
+        display->println("V");
+      }
+      drawBigNumber(display, 42, 6, toTenths(vBatt), 1);
+      flushDisplay(display);
       
       // Update previous value
       vBatt_prev = vBatt;
@@ -1142,45 +1330,30 @@ void dispBattVoltGfx (Adafruit_SSD1306 *display) {
 
 void dispFuelLvlGfx (Adafruit_SSD1306 *display) {
     // Check if mode changed or fuel level changed enough to warrant update
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-    }
+    bool modeChanged = screenModeChanged(display);
     
     // Redraw when the displayed value has changed (metric: 0dp liters; imperial: 1dp gallons)
-    if (modeChanged || (units == 0
-          ? (int)roundf(fuelLvl * 3.785f) != (int)roundf(fuelLvl_prev * 3.785f)
-          : (int)roundf(fuelLvl * 10.0f)  != (int)roundf(fuelLvl_prev * 10.0f))) {
-      float fuelLvlDisp;
-      display->setTextColor(WHITE); 
-      display->clearDisplay();             //clear buffer
-      display->drawBitmap(0, 0, IMG_FUEL_LVL, 32, 32, 1);
-      byte center = 71;
+    byte conv = (units == 0) ? CONV_GAL_TO_L : CONV_NONE;
+    byte decimals = (units == 0) ? 0 : 1;
+    long fuelLvlDisp = displayValue(toTenths(fuelLvl), conv, decimals);
+    if (modeChanged || fuelLvlDisp != displayValue(toTenths(fuelLvl_prev), conv, decimals)) {
+      beginIconScreen(display, modeChanged, IMG_FUEL_LVL, 32, SCREEN_W);
       
-      if (units == 0){    // Metric Units
-        fuelLvlDisp = fuelLvl*3.785; // convert to liters
-        byte nDig = digits(fuelLvlDisp);
+      if (units == 0){    // Metric Units (liters)
+        int16_t x = drawBigNumber(display, 71, 6, fuelLvlDisp, 0, ALIGN_CENTER);
         display->setTextSize(3); 
-        display->setCursor(center-((nDig*18)/2),6);
-        display->print(fuelLvlDisp, 0);
-        display->setCursor(center+((nDig*18)/2)+4,6);
+        display->setCursor(x+4,6);
         display->println("l");
       }
 
-      else {              // 'Merican Units
-        fuelLvlDisp = fuelLvl; // read in gallons
-        byte nDig = digits(fuelLvlDisp) +2 ;
-        display->setTextSize(3); 
-        display->setCursor(center-((nDig*18)/2),6);
-        display->print(fuelLvlDisp, 1);
-        display->setCursor(center+((nDig*18)/2)+2,18);
+      else {              // 'Merican Units (gallons)
+        int16_t x = drawBigNumber(display, 71, 6, fuelLvlDisp, 1, ALIGN_CENTER);
+        display->setCursor(x+2,18);
         display->setTextSize(1); 
         display->println("gal");
       }
 
-      display->display();
+      flushDisplay(display);
       
       // Update previous value
       fuelLvl_prev = fuelLvl;
@@ -1191,50 +1364,41 @@ void dispTripOdo (Adafruit_SSD1306 *display) {
     // No dirty tracking — always redraw on every call (every 500 ms via display timer).
     // Dirty tracking caused the display to freeze during driving because the odometer
     // increments in steps too small to cross the threshold between timer ticks.
-    float odoDisp;
     display->setTextColor(WHITE); 
     display->clearDisplay();
           
+    long odoTenths = displayValue(toTenths(odoTrip), (units == 0) ? CONV_NONE : CONV_KM_TO_MI, 1);
     if (units == 0){    // Metric Units
-      odoDisp = odoTrip; 
       display->setCursor(100,10);
       display->setTextSize(2);
       display->println("km");         
     } 
     else {              // 'Merican units
-      odoDisp = odoTrip * 0.6213712; //convert km to miles  
       display->setCursor(100,10);
       display->setTextSize(2);
       display->println("mi");          
     }
 
-    display->setCursor(35,10);
-    display->setTextSize(2); 
-    // right justify
-    if (odoDisp < 10) {
-      display->setTextColor(BLACK); 
-      display->print("00");
-    }
-    else if (odoDisp < 100){
-      display->setTextColor(BLACK); 
-      display->print("0");
-    }
-    
-    display->setTextColor(WHITE);
-    // remove tenths once 1000 is reached
-    if (odoDisp < 1000) { 
-      display->println(odoDisp, 1);
-    }
-    else {
-      display->println(odoDisp, 0);
+    // Remove tenths once 1000 is reached; right justify by skipping one 12px cell
+    // per missing integer digit below 100
+    char buf[13];
+    byte skip = 0;
+    if (odoTenths < 10000) {
+      formatFixed(buf, odoTenths, 1);
+      skip = (odoTenths < 100) ? 2 : (odoTenths < 1000) ? 1 : 0;
+    } else {
+      formatFixed(buf, (odoTenths + 5) / 10, 0);
     }
+    display->setCursor(35 + skip * 12,10);
+    display->setTextSize(2); 
+    display->println(buf);
     
     display->setTextSize(1);
     display->setCursor(1,7);
     display->println("Trip");
     display->setCursor(1,17);
     display->println("Odo:"); 
-    display->display();
+    flushDisplay(display);
 }
 
 void dispOdoResetYes(Adafruit_SSD1306 *display) {
@@ -1250,7 +1414,7 @@ void dispOdoResetYes(Adafruit_SSD1306 *display) {
     display->setCursor(76,16);
     display->setTextColor(WHITE); 
     display->println("NO");
-    display->display();
+    flushDisplay(display);
 }
 
 void dispOdoResetNo(Adafruit_SSD1306 *display) {
@@ -1266,17 +1430,12 @@ void dispOdoResetNo(Adafruit_SSD1306 *display) {
     display->setCursor(76,16);
     display->setTextColor(BLACK); 
     display->println("NO");
-    display->display();
+    flushDisplay(display);
 }
 
 void dispIgnAng (Adafruit_SSD1306 *display) {
     // Check if mode changed or ignition angle changed enough to warrant update
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-    }
+    bool modeChanged = screenModeChanged(display);
     
     // Redraw when the displayed integer value (ignAngCAN/10) has changed
     if (modeChanged || ignAngCAN/10 != ignAngCAN_prev/10) {
@@ -1287,12 +1446,11 @@ void dispIgnAng (Adafruit_SSD1306 *display) {
       display->println("IGN");
       display->setCursor(2,15);
       display->println("BTDC");            
-      display->setTextSize(3); 
-      display->setCursor(66,6);
-      display->print(ignAngCAN/10); 
+      drawBigNumber(display, 66, 6, ignAngCAN/10, 0);
+      display->setTextSize(3);             // Degree glyph through GFX at the blitted size
       display->write(0xF7);  
       display->println();      
-      display->display();
+      flushDisplay(display);
       
       // Update previous value
       ignAngCAN_prev = ignAngCAN;
@@ -1301,12 +1459,7 @@ void dispIgnAng (Adafruit_SSD1306 *display) {
 
 void dispInjDuty (Adafruit_SSD1306 *display) {
     // Check if mode changed or injector duty changed enough to warrant update
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-    }
+    bool modeChanged = screenModeChanged(display);
     
     // Redraw when the displayed integer value (injDutyCAN/10) has changed
     if (modeChanged || injDutyCAN/10 != injDutyCAN_prev/10) {
@@ -1317,11 +1470,9 @@ void dispInjDuty (Adafruit_SSD1306 *display) {
       display->println("INJ");
       display->setCursor(2,15);
       display->println("DUTY");            
-      display->setTextSize(3); 
-      display->setCursor(66,6);
-      display->print(injDutyCAN/10);  
-      display->println("%");      
-      display->display();
+      int16_t x = drawBigNumber(display, 66, 6, injDutyCAN/10, 0);
+      drawBigText(display, x, 6, "%");
+      flushDisplay(display);
       
       // Update previous value
       injDutyCAN_prev = injDutyCAN;
@@ -1336,149 +1487,112 @@ void dispInjDuty (Adafruit_SSD1306 *display) {
  * Bar gauge displays pressure range with visual representation.
  * Supports both metric (kPa) and imperial (PSI) units.
  * 
+ * Incremental: the static frame (icon, outline, ticks) is drawn only on a mode or
+ * units change, or when another panel has used the shared frame buffer since. Afterwards only the columns between the previous and new bar end
+ * are rewritten, as whole page bytes via writeColumnBits(), and nothing is drawn or
+ * flushed unless the bar moved by at least one pixel.
+ * 
  * @param display - Pointer to display object
  */
 void dispBoostGfx(Adafruit_SSD1306 *display) {
-  // Check if mode changed or boost pressure changed enough to warrant update
-  bool modeChanged = false;
-  if (display == &display1) {
-    modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-  } else {
-    modeChanged = (dispArray2[0] != dispArray2_prev);
+  // Bar gauge constants
+  const int BAR_X = 29;
+  const int BAR_Y = 8;
+  const int BAR_WIDTH = 96;
+  const int BAR_HEIGHT = 18;
+  const int INNER_Y = BAR_Y + 1;        // Fill area: rows 9-24, inside a 1px gap
+  const int INNER_H = BAR_HEIGHT - 2;
+
+  // Bar state last drawn into each display's buffer
+  static int lastBarPos[NUM_DISPLAYS];
+  static byte lastUnits[NUM_DISPLAYS];
+  byte idx = displayIndex(display);
+
+  // Check if mode changed (the frame must then be redrawn from scratch)
+  bool modeChanged = screenModeChanged(display);
+
+  // Scale for the selected units, in tenths: metric is absolute kPa, imperial is gauge PSI
+  const int ticksKpa[5] = { 500, 1000, 1500, 2000, 2500 };
+  const int ticksPsi[5] = { -73, 0, 73, 147, 218 };
+  const int *ticks;
+  long value;
+  int barMin, barMax, zeroValue;
+  if (units == 0) {  // Metric units (kPa)
+    value = toTenths(boostPrs);
+    barMin = 0;
+    barMax = 3000;
+    zeroValue = 1010;  // Atmospheric pressure
+    ticks = ticksKpa;
+  } else {           // Imperial units (PSI)
+    value = displayValue(toTenths(boostPrs), CONV_KPA_TO_PSIG, 1);  // Gauge pressure (relative to atmospheric)
+    barMin = -147;
+    barMax = 294;
+    zeroValue = 0;
+    ticks = ticksPsi;
   }
-  
-  // Only update if mode changed or value changed significantly
-  if (modeChanged || needsUpdate_Boost(boostPrs, boostPrs_prev, units)) {
-    // Bar gauge constants
-    const int BAR_X = 29;
-    const int BAR_Y = 8;
-    const int BAR_WIDTH = 96;
-    const int BAR_HEIGHT = 18;
-    
+
+  // Pressure to bar column: BAR_X + (p - barMin) * BAR_WIDTH / span, truncated
+  long span = barMax - barMin;
+  int barPos = BAR_X + (constrain(value, barMin, barMax) - barMin) * BAR_WIDTH / span;
+  int zeroX = BAR_X + (long)(zeroValue - barMin) * BAR_WIDTH / span;
+
+  bool fullRedraw = modeChanged || units != lastUnits[idx]
+                  || frameOwner != display;  // Shared buffer holds another panel's frame (or none yet)
+  if (!fullRedraw && barPos == lastBarPos[idx]) {
+    boostPrs_prev = boostPrs;
+    return;  // Bar has not moved by a pixel: nothing to draw
+  }
+
+  // Columns to repaint: the whole fill area, or only the span the bar end moved across.
+  // Fill is always bounded by zeroX, so the old and new bar ends bracket every changed column.
+  int fromX = BAR_X;
+  int toX = BAR_X + BAR_WIDTH;
+  if (fullRedraw) {
     display->clearDisplay();
-    display->setTextColor(SSD1306_WHITE);
-    
+
     // Draw turbo icon on the left
-    display->drawBitmap(0, 4, IMG_TURBO, 24, 30, 1);
-    
-    if (units == 0) {  // Metric units (kPa)
-      float kpa = boostPrs;
-      const float BAR_MIN = 0.0;
-      const float BAR_MAX = 300.0;
-      const float ZERO_KPA = 101.0;  // Atmospheric pressure
-      
-      // Draw 2px bar outline with rounded corners
-      display->drawRect(BAR_X - 2, BAR_Y - 2, BAR_WIDTH + 4, BAR_HEIGHT + 4, SSD1306_WHITE);
-      display->drawRect(BAR_X - 1, BAR_Y - 1, BAR_WIDTH + 2, BAR_HEIGHT + 2, SSD1306_WHITE);
-      
-      // Clear corner pixels for rounded appearance
-      display->drawPixel(BAR_X - 2, BAR_Y - 2, 0);
-      display->drawPixel(BAR_X + BAR_WIDTH + 1, BAR_Y - 2, 0);
-      display->drawPixel(BAR_X + BAR_WIDTH + 1, BAR_Y + BAR_HEIGHT + 1, 0);
-      display->drawPixel(BAR_X - 2, BAR_Y + BAR_HEIGHT + 1, 0);
-      
-      int innerY = BAR_Y + 1;
-      int innerH = BAR_HEIGHT - 2;
-      
-      // Calculate bar position and zero point
-      float barPosition = mapFloat(kpa, BAR_MIN, BAR_MAX, 0, BAR_WIDTH);
-      barPosition = constrain(barPosition, 0, BAR_WIDTH);
-      float zeroPosition = mapFloat(ZERO_KPA, BAR_MIN, BAR_MAX, 0, BAR_WIDTH);
-      
-      int barPos = BAR_X + barPosition;
-      int zeroX = BAR_X + zeroPosition;
-      
-      // Fill bar: checkered for vacuum, solid for boost
-      if (kpa >= ZERO_KPA) {
-        // Boost - solid fill
-        int fillW = barPos - zeroX;
-        if (fillW > 0) {
-          display->fillRect(zeroX, innerY, fillW, innerH, SSD1306_WHITE);
-        }
-      } else {
-        // Vacuum - checkered pattern
-        int fillX = barPos;
-        int fillW = zeroX - barPos;
-        
-        for (int x = fillX; x < zeroX; x++) {
-          for (int y = innerY; y < innerY + innerH; y++) {
-            if ((((zeroX - x) >> 1) + ((y - innerY) >> 1)) & 1) {
-              display->drawPixel(x, y, SSD1306_WHITE);
-            }
-          }
-        }
-      }
-      
-      // Draw tick marks at key pressure points
-      float ticks[] = { 50, 100, 150, 200, 250 };
-      for (byte i = 0; i < 5; i++) {
-        float px = mapFloat(ticks[i], BAR_MIN, BAR_MAX, 0, BAR_WIDTH);
-        int x = BAR_X + px;
-        display->drawFastVLine(x, innerY, innerH, SSD1306_WHITE);
-      }
-      
-    } else {  // Imperial units (PSI)
-      // Convert to gauge pressure (relative to atmospheric)
-      float psi = boostPrs * 0.1450377 - 14.7;
-      const float BAR_MIN = -14.7;
-      const float BAR_MAX = 29.4;
-      
-      // Draw 2px bar outline with rounded corners
-      display->drawRect(BAR_X - 2, BAR_Y - 2, BAR_WIDTH + 4, BAR_HEIGHT + 4, SSD1306_WHITE);
-      display->drawRect(BAR_X - 1, BAR_Y - 1, BAR_WIDTH + 2, BAR_HEIGHT + 2, SSD1306_WHITE);
-      
-      // Clear corner pixels for rounded appearance
-      display->drawPixel(BAR_X - 2, BAR_Y - 2, 0);
-      display->drawPixel(BAR_X + BAR_WIDTH + 1, BAR_Y - 2, 0);
-      display->drawPixel(BAR_X + BAR_WIDTH + 1, BAR_Y + BAR_HEIGHT + 1, 0);
-      display->drawPixel(BAR_X - 2, BAR_Y + BAR_HEIGHT + 1, 0);
-      
-      int innerY = BAR_Y + 1;
-      int innerH = BAR_HEIGHT - 2;
-      
-      // Calculate bar and zero positions
-      float barPosition = mapFloat(psi, BAR_MIN, BAR_MAX, 0, BAR_WIDTH);
-      barPosition = constrain(barPosition, 0, BAR_WIDTH);
-      float zeroPosition = mapFloat(0, BAR_MIN, BAR_MAX, 0, BAR_WIDTH);
-      
-      int barPos = BAR_X + barPosition;
-      int zeroX = BAR_X + zeroPosition;
-      
-      // Fill bar based on positive (boost) or negative (vacuum) pressure
-      if (psi >= 0) {
-        // Positive boost - solid fill
-        int fillW = barPos - zeroX;
-        if (fillW > 0) {
-          display->fillRect(zeroX, innerY, fillW, innerH, SSD1306_WHITE);
-        }
-      } else {
-        // Negative pressure (vacuum) - checkered pattern
-        int fillX = barPos;
-        int fillW = zeroX - barPos;
-        
-        for (int x = fillX; x < zeroX; x++) {
-          for (int y = innerY; y < innerY + innerH; y++) {
-            if ((((zeroX - x) >> 1) + ((y - innerY) >> 1)) & 1) {
-              display->drawPixel(x, y, SSD1306_WHITE);
-            }
-          }
-        }
-      }
-      
-      // Draw tick marks at key pressure points
-      float ticks[] = { -7.3, 0, 7.3, 14.7, 21.8 };
-      for (byte i = 0; i < 5; i++) {
-        float px = mapFloat(ticks[i], BAR_MIN, BAR_MAX, 0, BAR_WIDTH);
-        int x = BAR_X + px;
-        display->drawFastVLine(x, innerY, innerH, SSD1306_WHITE);
-      }
+    drawImage(display, 0, 0, IMG_TURBO);
+
+    // Draw 2px bar outline with rounded corners
+    display->drawRect(BAR_X - 2, BAR_Y - 2, BAR_WIDTH + 4, BAR_HEIGHT + 4, SSD1306_WHITE);
+    display->drawRect(BAR_X - 1, BAR_Y - 1, BAR_WIDTH + 2, BAR_HEIGHT + 2, SSD1306_WHITE);
+
+    // Clear corner pixels for rounded appearance
+    display->drawPixel(BAR_X - 2, BAR_Y - 2, 0);
+    display->drawPixel(BAR_X + BAR_WIDTH + 1, BAR_Y - 2, 0);
+    display->drawPixel(BAR_X + BAR_WIDTH + 1, BAR_Y + BAR_HEIGHT + 1, 0);
+    display->drawPixel(BAR_X - 2, BAR_Y + BAR_HEIGHT + 1, 0);
+  } else {
+    fromX = min(barPos, lastBarPos[idx]);
+    toX = max(barPos, lastBarPos[idx]);
+  }
+
+  // Tick marks at key pressure points
+  int tickX[5];
+  for (byte i = 0; i < 5; i++) {
+    tickX[i] = BAR_X + (long)(ticks[i] - barMin) * BAR_WIDTH / span;
+  }
+
+  // Repaint each column of the fill area with whole page bytes:
+  // tick = solid, boost = solid, vacuum = checkered (2x2 cells anchored at zeroX), else empty
+  bool vacuum = value < zeroValue;
+  for (int x = fromX; x < toX; x++) {
+    uint16_t bits = 0;
+    if (vacuum ? (x >= barPos && x < zeroX) : (x >= zeroX && x < barPos)) {
+      bits = vacuum ? ((((zeroX - x) >> 1) & 1) ? 0x3333 : 0xCCCC) : 0xFFFF;
     }
-    
-    display->display();
-    
-    // Update previous value
-    boostPrs_prev = boostPrs;
+    for (byte i = 0; i < 5; i++) {
+      if (x == tickX[i]) bits = 0xFFFF;
+    }
+    writeColumnBits(display, x, INNER_Y, INNER_H, bits);
   }
+
+  flushDisplay(display);
+
+  // Update previous values
+  lastBarPos[idx] = barPos;
+  lastUnits[idx] = units;
+  boostPrs_prev = boostPrs;
 }
 
 /**
@@ -1492,12 +1606,7 @@ void dispBoostGfx(Adafruit_SSD1306 *display) {
  */
 void dispBoost(Adafruit_SSD1306 *display) {
   // Check if mode changed or boost pressure changed enough to warrant update
-  bool modeChanged = false;
-  if (display == &display1) {
-    modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-  } else {
-    modeChanged = (dispArray2[0] != dispArray2_prev);
-  }
+  bool modeChanged = screenModeChanged(display);
   
   // Only update if mode changed or value changed significantly
   if (modeChanged || needsUpdate_Boost(boostPrs, boostPrs_prev, units)) {
@@ -1505,11 +1614,9 @@ void dispBoost(Adafruit_SSD1306 *display) {
     display->clearDisplay();
     
     // Draw turbo icon on the left side
-    display->drawBitmap(0, 4, IMG_TURBO, 24, 30, 1);
+    drawImage(display, 0, 0, IMG_TURBO);
     
     if (units == 0) {  // Metric units (kPa)
-      float kpa = boostPrs;
-      int kpaInt = (int)kpa;
       
       // Position units label at right side (text size 2)
       // Display width is 128px, "kPa" is 3 chars * 12px = 36px
@@ -1518,17 +1625,12 @@ void dispBoost(Adafruit_SSD1306 *display) {
       display->setCursor(92, 10);  // Fixed position for units on right
       display->print("kPa");
       
-      // Calculate position for value (right-aligned next to units)
-      // Text size 2: each digit is 12px wide
-      display->setTextSize(3);
-      byte nDig = digits(kpaInt);
-      int valueX = 92 - (nDig * 18) - 3;  // 3px gap before units
-      display->setCursor(valueX, 6);
-      display->print(kpaInt, DEC);
+      // Value right-aligned next to units, 3px gap
+      drawBigNumber(display, 92 - 3, 6, displayValue(toTenths(boostPrs), CONV_NONE, 0), 0, ALIGN_RIGHT);
       
     } else {  // Imperial units (PSI)
-      // Convert to gauge pressure (relative to atmospheric)
-      float psi = boostPrs * 0.1450377 - 14.7;
+      // Gauge pressure (relative to atmospheric), 1 decimal
+      long psi = displayValue(toTenths(boostPrs), CONV_KPA_TO_PSIG, 1);
       
       // Position units label at right side (text size 2)
       // Display width is 128px, "PSI" is 3 chars * 12px = 36px
@@ -1538,17 +1640,11 @@ void dispBoost(Adafruit_SSD1306 *display) {
       // display->setCursor(102, 10);  // Fixed position for units on right
       // display->print("PSI");
       
-      // Calculate position for value with 1 decimal (right-aligned next to units)
-      // Text size 2: each digit/decimal is ~12px wide, decimal point ~6px
-      display->setTextSize(3);
-      byte nDig = digits(psi);
-      // Account for decimal point and one decimal digit: add ~18px (1 digit + point)
-      int valueX = 78 - (nDig* 18);    
-      display->setCursor(valueX, 6);
-      display->print(psi, 1);
+      // Value right-aligned so the last cell ends at x=114
+      drawBigNumber(display, 114, 6, psi, 1, ALIGN_RIGHT);
     }
     
-    display->display();
+    flushDisplay(display);
     
     // Update previous value
     boostPrs_prev = boostPrs;
@@ -1571,12 +1667,7 @@ void dispBoost(Adafruit_SSD1306 *display) {
  */
 void dispClock (Adafruit_SSD1306 *display){
     // Check if mode changed or time changed or clockOffset changed
-    bool modeChanged = false;
-    if (display == &display1) {
-      modeChanged = needsUpdate_ModeChange(dispArray1, dispArray1_prev, 4);
-    } else {
-      modeChanged = (dispArray2[0] != dispArray2_prev);
-    }
+    bool modeChanged = screenModeChanged(display);
     
     // Check if clock offset changed (for adjustment mode)
     bool offsetChanged = (clockOffset != clockOffset_prev);
@@ -1594,17 +1685,14 @@ void dispClock (Adafruit_SSD1306 *display){
         hourAdj = clockOffset + hour;
       }
 
-      byte nDig = digits(hourAdj)+3;  // +3 for colon and 2-digit minutes
-      byte center = 63;
-      
-      display->setTextColor(WHITE);
-      display->setTextSize(3);
-      display->setCursor(center-((nDig*18)/2),6);
-      display->print(hourAdj); 
-      display->print(':');
-      if (minute < 10) { display->print('0'); }  // Zero-pad minutes (e.g., "03" not "3")
-      display->println(minute);
-      display->display();
+      char buf[13];  // "H:MM" / "HH:MM", minutes zero-padded (e.g., "03" not "3")
+      byte len = formatFixed(buf, hourAdj, 0);
+      buf[len++] = ':';
+      buf[len++] = '0' + minute / 10;
+      buf[len++] = '0' + minute % 10;
+      buf[len] = '\0';
+      drawBigText(display, 63 - len * FONT_X3_ADVANCE / 2, 6, buf);  // Centered on x=63
+      flushDisplay(display);
       
       // Update previous values
       hour_prev = hour;
@@ -1613,36 +1701,6 @@ void dispClock (Adafruit_SSD1306 *display){
     }
 }
 
-/**
- * digits - Count number of digits in a number
- * 
- * Helper function for dynamic text centering on displays.
- * Determines how many character widths are needed for a number.
- * 
- * @param val - Number to count digits for (can be negative)
- * @return Number of digits (1-4), includes sign for negative numbers
- * 
- * Example: 
- * - digits(5) = 1
- * - digits(42) = 2
- * - digits(-7) = 2 (includes minus sign)
- */
-byte digits(float val){
-  byte nDigits;
-  if (val >= 0){ 
-    if (val < 10)         {nDigits = 1;}
-    else if (val < 100)   {nDigits = 2;}
-    else if (val < 1000)  {nDigits = 3;}
-    else if (val < 10000) {nDigits = 4;}
-  }
-  else {  // Negative numbers - count includes minus sign
-    if (val > -10)        {nDigits = 2;}  // "-" + 1 digit
-    else if (val > -100)  {nDigits = 3;}  // "-" + 2 digits
-    else if (val > -1000) {nDigits = 4;}  // "-" + 3 digits
-  }
-  return nDigits;
-}
-
 /*
  * ========================================
  * DISPLAY OPTIMIZATION FUNCTIONS
@@ -1664,17 +1722,15 @@ byte digits(float val){
  * @return true if the displayed integer value would change
  */
 bool needsUpdate_Temperature(float current, float previous) {
-  float dispCurrent  = (units == 0) ? current  : current  * 1.8f + 32.0f;
-  float dispPrevious = (units == 0) ? previous : previous * 1.8f + 32.0f;
-  return (int)roundf(dispCurrent) != (int)roundf(dispPrevious);
+  byte conv = (units == 0) ? CONV_NONE : CONV_C_TO_F;
+  return displayValue(toTenths(current), conv, 0) != displayValue(toTenths(previous), conv, 0);
 }
 
 /**
  * needsUpdate_Pressure - Check if the displayed pressure value changed
  * 
  * Compares the rounded value that will actually be rendered:
- *   - Metric: bar with 1 decimal place. 1 display step = 0.1 bar = 10 kPa.
- *     Dividing kPa by 10 gives the 1dp bar value × 10; rounding to int detects the step.
+ *   - Metric: bar with 1 decimal place (1 display step = 0.1 bar = 10 kPa)
  *   - Imperial: PSI displayed with 0 decimal places (1 PSI ≈ 6.89 kPa resolution)
  * 
  * @param current - Current pressure in kPa
@@ -1683,11 +1739,9 @@ bool needsUpdate_Temperature(float current, float previous) {
  * @return true if the displayed value would change
  */
 bool needsUpdate_Pressure(float current, float previous, byte units) {
-  if (units == 0) {  // bar, 1 dp: 1 display step = 0.1 bar = 10 kPa → compare kPa/10
-    return (int)roundf(current / 10.0f) != (int)roundf(previous / 10.0f);
-  } else {           // PSI, 0 dp
-    return (int)roundf(current * 0.1450377f) != (int)roundf(previous * 0.1450377f);
-  }
+  byte conv = (units == 0) ? CONV_KPA_TO_BAR : CONV_KPA_TO_PSI;
+  byte decimals = (units == 0) ? 1 : 0;  // bar 1 dp, PSI 0 dp
+  return displayValue(toTenths(current), conv, decimals) != displayValue(toTenths(previous), conv, decimals);
 }
 
 /**
@@ -1702,11 +1756,8 @@ bool needsUpdate_Pressure(float current, float previous, byte units) {
  * @return true if the displayed integer value would change
  */
 bool needsUpdate_Speed(int current, int previous) {
-  if (units == 0) {  // Metric km/h, 0 dp (spd stored as km/h × 100, so divide by 100)
-    return (int)roundf(current / 100.0f) != (int)roundf(previous / 100.0f);
-  } else {           // Imperial mph, 0 dp (factor = 0.6213711922 ÷ 100 to convert km/h×100 → mph)
-    return (int)roundf(current * 0.006213711922f) != (int)roundf(previous * 0.006213711922f);
-  }
+  byte conv = (units == 0) ? CONV_NONE : CONV_KM_TO_MI;
+  return displayValue(speedTenths(current), conv, 0) != displayValue(speedTenths(previous), conv, 0);
 }
 
 /**
@@ -1727,7 +1778,7 @@ bool needsUpdate_RPM(int current, int previous) {
  * needsUpdate_Boost - Check if the displayed boost/MAP value changed
  * 
  * Compares the rounded value that will actually be rendered:
- *   - Metric: kPa displayed as integer (truncated)
+ *   - Metric: kPa displayed as integer
  *   - Imperial: PSI gauge pressure displayed with 1 decimal place
  *
  * @param current - Current boost/MAP pressure in kPa
@@ -1736,13 +1787,9 @@ bool needsUpdate_RPM(int current, int previous) {
  * @return true if the displayed value would change
  */
 bool needsUpdate_Boost(float current, float previous, byte units) {
-  if (units == 0) {  // kPa, displayed as integer (truncated cast)
-    return (int)current != (int)previous;
-  } else {           // PSI gauge, 1 dp
-    float psiCurrent  = current  * 0.1450377f - 14.7f;
-    float psiPrevious = previous * 0.1450377f - 14.7f;
-    return (int)roundf(psiCurrent * 10.0f) != (int)roundf(psiPrevious * 10.0f);
-  }
+  byte conv = (units == 0) ? CONV_NONE : CONV_KPA_TO_PSIG;
+  byte decimals = (units == 0) ? 0 : 1;  // kPa 0 dp, PSI gauge 1 dp
+  return displayValue(toTenths(current), conv, decimals) != displayValue(toTenths(previous), conv, decimals);
 }
 
 /**
@@ -1779,76 +1826,144 @@ bool needsUpdate_ModeChange(byte* current, byte* previous, int size) {
   return false;
 }
 
+// ===== ADAPTIVE REFRESH GOVERNOR =====
+// Each panel's interval starts at its screen's registry rate, halves (down to a third of it)
+// while updates keep producing new frames, and creeps back up (to three times it) while
+// they do not. A token bucket caps display time for all panels together; when it runs
+// dry no screen may refresh faster than its registry rate.
+static byte govScreen[NUM_DISPLAYS];         // Registry entry each panel's interval belongs to
+static bool govValid[NUM_DISPLAYS];          // govScreen/govInterval set by a first update
+static unsigned int govInterval[NUM_DISPLAYS];  // Governed interval per panel (ms)
+static long govBudgetUs = DISP_BUDGET_US;    // Display time left in the bucket (µs)
+static unsigned long govBudgetTime = 0;      // millis() of the last refill
+
+// screenInterval - Registry refresh interval of a registry entry (143 ms if out of range)
+static unsigned int screenInterval(byte screen) {
+  return (screen < SCREEN_TOTAL) ? pgm_read_word(&SCREENS[screen].intervalMs) : 143;
+}
+
 /**
- * getDisplayUpdateInterval - Get appropriate refresh rate for display mode
+ * getDisplayUpdateInterval - Get the current refresh interval for a panel
  * 
- * Variable refresh rates based on content type:
+ * Base rates come from the intervalMs column of the screen registry (SCREENS):
+ * - 33ms (30Hz): Boost bar - incremental column updates
  * - 83ms (12Hz): RPM - needs fast updates for responsiveness
  * - 143ms (7Hz): Pressures, speed, AFR, ignition, injector - moderate updates
  * - 500ms (2Hz): Temps, battery, fuel level, clock, odometer - slow changing values
  * - 1000ms (1Hz): Static logos - minimal updates (check for mode change only)
+ * and are then adjusted by displayGovernorUpdate() to how fast the shown value changes.
  * 
- * @param displayMode - The display mode/case number
- * @param displayNum - Which display: 1 or 2
+ * @param panel - Panel index (0 = display1)
  * @return Update interval in milliseconds
  */
-unsigned int getDisplayUpdateInterval(byte displayMode, byte displayNum) {
-  // Display 1 refresh rates
-  if (displayNum == 1) {
-    switch (displayMode) {
-      case 5:   // RPM
-      case 9:   // Boost gauge with bar (12Hz, same as RPM)
-      case 10:  // Boost text display (12Hz, same as RPM)
-        return 83;
-      
-      case 6:   // Speed
-      case 7:   // AFR
-      case 8:   // Fuel Pressure
-      case 13:  // Injector Duty
-      case 14:  // Ignition Timing
-        return 143;
-      
-      case 0:   // Settings menu
-      case 1:   // Oil Pressure
-      case 2:   // Coolant Temp
-      case 3:   // Fuel Level
-      case 4:   // Battery Voltage
-      case 11:  // Oil Temp
-      case 12:  // Fuel Composition
-      case 15:  // Trip Odometer
-      case 16:  // Clock
-        return 500;
-      
-      case 17:  // Falcon Script logo
-        return 1000;
-      
-      default:
-        return 143;
-    }
+static unsigned int getDisplayUpdateInterval(byte panel) {
+  byte screen = panelScreen(panel);
+  return (govValid[panel] && screen == govScreen[panel]) ? govInterval[panel] : screenInterval(screen);
+}
+
+/**
+ * displayGovernorUpdate - Adapt a panel's refresh interval after a scheduled update
+ * 
+ * A new frame reaching the panel means the value is moving: halve the interval, down
+ * to max(base / 3, DISP_GOV_MIN_MS). An update that sent nothing backs off by 1/8,
+ * up to min(base * 3, DISP_GOV_MAX_MS). The measured update time is charged to the
+ * shared budget, which refills at DISP_BUDGET_US per second; while it is overdrawn the
+ * interval is held at or above the registry rate.
+ * 
+ * @param panel - Panel index (0 = display1)
+ * @param elapsedUs - Time the update (render + flush) took, from micros()
+ */
+static void displayGovernorUpdate(byte panel, unsigned long elapsedUs) {
+  byte screen = panelScreen(panel);
+  unsigned int base = screenInterval(screen);
+
+  unsigned long now = millis();
+  govBudgetUs += (long)(now - govBudgetTime) * (long)(DISP_BUDGET_US / 1000);
+  govBudgetTime = now;
+  if (govBudgetUs > (long)DISP_BUDGET_US) govBudgetUs = DISP_BUDGET_US;  // At most one second saved up
+  govBudgetUs -= (long)elapsedUs;
+
+  if (!govValid[panel] || screen != govScreen[panel]) {  // New screen: start from its registry rate
+    govScreen[panel] = screen;
+    govValid[panel] = true;
+    govInterval[panel] = base;
+    frameSent[panel] = false;
+    return;
   }
-  // Display 2 refresh rates
-  else {
-    switch (displayMode) {
-      case 4:   // RPM
-      case 6:   // Boost gauge with bar (12Hz, same as RPM)
-      case 7:   // Boost text display (12Hz, same as RPM)
-        return 83;
-      
-      case 5:   // Speed
-        return 143;
-      
-      case 0:   // Oil Pressure
-      case 1:   // Coolant Temp
-      case 2:   // Fuel Level
-      case 3:   // Battery Voltage
-      case 8:   // Clock
-        return 500;
-      
-      case 9:   // Falcon Script logo
-        return 1000;
-      
-      default:
-        return 143;
+
+  unsigned int fastest = max(base / 3, DISP_GOV_MIN_MS);
+  unsigned int slowest = min(base * 3, DISP_GOV_MAX_MS);
+  unsigned int interval = govInterval[panel];
+  if (frameSent[panel]) {
+    interval = max(interval / 2, fastest);
+  } else {
+    interval = min(interval + interval / 8 + 1, slowest);
+  }
+  if (govBudgetUs < 0 && interval < base) {
+    interval = base;  // Over budget: no faster than the registry rate
+  }
+  govInterval[panel] = interval;
+  frameSent[panel] = false;
+}
+
+// ===== FLUSH ARBITER =====
+// All panels share one SPI bus and one frame buffer, so at most one panel renders and
+// flushes per call: the motor, sensor and CAN work between loop passes never waits on
+// more than one frame. Panels owed a user-driven update go first, in panel order;
+// otherwise the panel furthest past its interval is served.
+static bool dispPending[NUM_DISPLAYS];  // Update owed to user input or a new selection
+
+/**
+ * serviceDisplays - Update the one panel that most needs it, if any is due
+ * 
+ * User input (button or encoder) makes every panel pending: display 1 shows the menu
+ * and the others may be previewing a selection. A changed selection makes that panel
+ * pending and forces its full redraw. The update's duration feeds the panel's governor.
+ */
+void serviceDisplays(void) {
+  if (button == 1 || encoderMoved) {
+    for (byte p = 0; p < NUM_DISPLAYS; p++) dispPending[p] = true;
+  }
+
+  unsigned long now = millis();
+  byte next = NUM_DISPLAYS;
+  long mostLate = 0;
+  for (byte p = 0; p < NUM_DISPLAYS; p++) {
+    if (p > 0 && dispSelect[p] != dispSelect_prev[p]) {
+      // Force a full redraw when the selection changed, so the display
+      // function always sees modeChanged=true and clears leftover content.
+      dispSelect_prev[p] = 255;
+      dispPending[p] = true;
+    }
+    if (dispPending[p]) {
+      next = p;
+      break;
+    }
+    long late = (long)(now - timerDispPanel[p]) - (long)getDisplayUpdateInterval(p);
+    if (late > mostLate) {
+      mostLate = late;
+      next = p;
     }
   }
+  if (next == NUM_DISPLAYS) {
+    return;  // Nothing due
+  }
+
+  // Force a full redraw when the user scrolled to a new screen, so the display
+  // function always sees modeChanged=true and clears leftover content.
+  if (next == 0 && encoderMoved) {
+    dispArray1_prev[0] = 255;
+  }
+  unsigned long dispStart = micros();
+  if (next == 0) {
+    dispMenu();
+  } else {
+    dispPanel(next);
+  }
+  displayGovernorUpdate(next, micros() - dispStart);  // Adapt the rate to how fast the value changes
+  timerDispPanel[next] = millis();
+  dispPending[next] = false;
+  if (next == 0) {
+    encoderMoved = false;  // Clear flag after update
+  }
 }
@@ -13,13 +13,63 @@
 #include <Arduino.h>
 #include <Adafruit_SSD1306.h>
 
+/**
+ * SharedBufferSSD1306 - SSD1306 panel that renders into a caller-supplied frame buffer
+ * 
+ * Adafruit_SSD1306::begin() only allocates when no buffer is set, so handing both
+ * panels the same array leaves one 512-byte frame buffer in SRAM instead of two on the heap.
+ * Screens are rendered and flushed one panel at a time (clear, draw, flushDisplay()),
+ * so a panel's image lives in its GDDRAM, not in the buffer, between updates.
+ * 
+ * The MCP2515 shares the SPI bus. sendFrame() replaces display() for flushes: it sends the
+ * frame in OLED_CHUNK_BYTES pieces and lets a pending CAN frame take the bus between them.
+ */
+class SharedBufferSSD1306 : public Adafruit_SSD1306 {
+  public:
+    SharedBufferSSD1306(uint8_t w, uint8_t h, SPIClass *spi, int8_t dcPin, int8_t rstPin, int8_t csPin, uint8_t *frame)
+      : Adafruit_SSD1306(w, h, spi, dcPin, rstPin, csPin) {
+      buffer = frame;
+    }
+    void sendFrame(void);  // display() in preemptible chunks (display.cpp)
+};
+
+// ===== SCREEN REGISTRY =====
+// Display flags: which panels may show a screen
+constexpr uint8_t SCREEN_DISP1 = 0x01;  // Display 1 (menu)
+constexpr uint8_t SCREEN_DISP2 = 0x02;  // Display 2 and up
+
+// Fault bindings: a screen showing a faulted reading flashes inverted
+constexpr uint8_t FAULT_NONE = 0x00;
+constexpr uint8_t FAULT_OIL = 0x01;
+constexpr uint8_t FAULT_COOLANT = 0x02;
+constexpr uint8_t FAULT_FUEL = 0x04;
+constexpr uint8_t FAULT_BATT = 0x08;
+
+// Screen descriptor (table SCREENS in display.cpp, stored in PROGMEM)
+struct ScreenDesc {
+  void (*render)(Adafruit_SSD1306 *display);  // Draws the screen; skips the redraw itself if nothing changed
+  uint16_t intervalMs;                        // Scheduled refresh interval
+  uint8_t fault;                              // FAULT_* flags that invert this screen
+  uint8_t displays;                           // SCREEN_DISP* flags
+};
+
+byte screenCount(byte displayNum);                    // Number of screens selectable on display 1 or on 2 and up
+byte screenFault(byte panel);                         // FAULT_* flags bound to the screen a panel shows (0 = display1)
+int panelSelectAddress(byte panel);                   // EEPROM address of dispSelect[panel] (panel 1 and up)
+
+// Frame buffer flush
+void flushDisplay(Adafruit_SSD1306 *display);      // Send buffer to panel unless its page checksums are unchanged
+void displayDumpNext(byte panel);                  // Print the panel's next flushed frame as PBM on Serial
+void displayStatsReport(void);                     // Print and reset SPI utilisation and per-screen flush counts
+void drawImage(Adafruit_SSD1306 *display, int16_t x, uint8_t page, const unsigned char *img);  // Decode RLE image from image_data.cpp into buffer
+
 // Main display control functions
-void disp2(void);                                    // Display 2 main controller
+void serviceDisplays(void);                           // Update at most one due panel (flush arbiter)
 void dispMenu();                                      // Display 1 menu system controller
 
 // Menu header screens
 void dispSettings(Adafruit_SSD1306 *display);       // "SETTINGS" header
-void dispDisp2Select(Adafruit_SSD1306 *display);    // "DISPLAY 2" header
+void dispDisp2Select(Adafruit_SSD1306 *display);    // "DISPLAY 2" header ("DISPLAYS" with more panels)
 void dispUnits(Adafruit_SSD1306 *display);          // "UNITS" header
 void dispClockOffset(Adafruit_SSD1306 *display);    // "SET CLOCK" header
 
@@ -56,9 +106,6 @@ void disp2300turbo(Adafruit_SSD1306 *display);      // 2300 Turbo Logo
 void dispOdoResetYes(Adafruit_SSD1306 *display);    // "YES" confirmation
 void dispOdoResetNo(Adafruit_SSD1306 *display);     // "NO" confirmation
 
-// Utility functions
-byte digits(float val);                              // Count digits in number for centering
-
 // Display optimization functions
 bool needsUpdate_Temperature(float current, float previous);  // Redraw when displayed integer (0dp, unit-converted) changes
 bool needsUpdate_Pressure(float current, float previous, byte units);  // Redraw when displayed value (1dp bar / 0dp PSI) changes
@@ -67,6 +114,5 @@ bool needsUpdate_RPM(int current, int previous);     // Redraw when integer RPM
 bool needsUpdate_Boost(float current, float previous, byte units);  // Redraw when displayed value (int kPa / 1dp PSI) changes
 bool needsUpdate_Time(byte hour_curr, byte minute_curr, byte hour_prev, byte minute_prev);  // Check if time changed
 bool needsUpdate_ModeChange(byte* current, byte* previous, int size);  // Check if display mode changed
-unsigned int getDisplayUpdateInterval(byte displayMode, byte displayNum);  // Get refresh rate for display mode (displayNum: 1 or 2)
 
 #endif // DISPLAY_H
@@ -12,7 +12,7 @@
  * This system receives inputs from GPS, analog sensors, and CAN bus, then outputs to:
  * - 4x stepper motors for gauge pointers (speedometer, fuel, coolant temp, etc.)
  * - LED warning lights and LED tachometer strip
- * - 2x OLED displays for various vehicle data
+ * - OLED displays for various vehicle data (displays[] table, NUM_DISPLAYS panels)
  * - CAN bus messages to other microcontrollers
  * 
  * The design is modular to simplify retrofitting vintage instrument panels with modern internals.
@@ -21,7 +21,7 @@
  * - Arduino Mega 2560 (or compatible)
  * - MCP2515 CAN bus controller
  * - Adafruit GPS module
- * - 2x SSD1306 OLED displays (128x32 pixels)
+ * - SSD1306 OLED displays (128x32 pixels), 2 by default, sharing one frame buffer
  * - 4x SwitecX12 stepper motors for gauge needles
  * - WS2812 LED strip for tachometer
  * - Rotary encoder for menu navigation
@@ -29,7 +29,7 @@
  * 
  * COMMUNICATION PROTOCOLS:
  * - CAN bus at 500kbps (Haltech ECU protocol)
- * - GPS at 9600 baud, NMEA RMC messages at 5Hz
+ * - GPS at 38400 baud on USART2 (RX interrupt), NMEA RMC (or UBX NAV-PVT) at 10Hz
  * - SPI for displays and CAN controller
  * 
  * ========================================
@@ -53,9 +53,6 @@
 // LED library
 #include <FastLED.h>
 
-// GPS library
-#include <Adafruit_GPS.h>
-
 // Stepper motor libraries
 #include <SwitecX25.h>
 #include <SwitecX12.h>
@@ -71,6 +68,7 @@
 #include "outputs.h"
 #include "menu.h"
 #include "utilities.h"
+#include "timebase.h"
 #include "image_data.h"
 
 
@@ -189,27 +187,35 @@ void setup() {
   digitalWrite(PWR_PIN, HIGH);
 
   // ===== GPS INITIALIZATION =====
-  GPS.begin(9600);
-  GPS.sendCommand(PMTK_SET_NMEA_OUTPUT_RMCONLY);
-  GPS.sendCommand(PMTK_SET_NMEA_UPDATE_5HZ);
-  GPS.sendCommand(PMTK_API_SET_FIX_CTL_5HZ);
-  useInterrupt(true);
+  gpsBegin();  // USART2 RX interrupt; gpsConfigService() finishes the switch to GPS_BAUD, 10 Hz
  
   // ===== HALL SENSOR INITIALIZATION =====
-  pinMode(HALL_PIN, INPUT_PULLUP);
-  attachInterrupt(digitalPinToInterrupt(HALL_PIN), hallSpeedISR, FALLING);
+  if (HALL_INPUT_CAPTURE) {
+    initHallInputCapture();
+  } else {
+    pinMode(HALL_PIN, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(HALL_PIN), hallSpeedISR, FALLING);
+  }
 
   // ===== ENGINE RPM SENSOR INITIALIZATION =====
-  pinMode(IGNITION_PULSE_PIN, INPUT_PULLUP);
-  attachInterrupt(digitalPinToInterrupt(IGNITION_PULSE_PIN), ignitionPulseISR, FALLING);
+  if (IGNITION_INPUT_CAPTURE) {
+    initIgnitionInputCapture();
+  } else {
+    pinMode(IGNITION_PULSE_PIN, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(IGNITION_PULSE_PIN),
+                    (TRIGGER_WHEEL_TEETH > 0) ? triggerWheelISR : ignitionPulseISR, FALLING);
+  }
 
   // ===== DISPLAY INITIALIZATION =====
   // Initialize displays (SPI clock speed set by library default)
   // begin(vccstate, i2caddr, reset, periphBegin)
-  display1.begin(SSD1306_SWITCHCAPVCC, 0, true, true);
-  display2.begin(SSD1306_SWITCHCAPVCC, 0, true, true);
+  for (byte p = 0; p < NUM_DISPLAYS; p++) {
+    displays[p].begin(SSD1306_SWITCHCAPVCC, 0, true, true);
+  }
   dispFalconScript(&display1);
-  disp2300turbo(&display2);
+  for (byte p = 1; p < NUM_DISPLAYS; p++) {
+    disp2300turbo(&displays[p]);
+  }
   
   // ===== STEPPER MOTOR INITIALIZATION =====
   pinMode(MOTOR_RST, OUTPUT);
@@ -241,18 +247,31 @@ void setup() {
   for (int i = 0; i < sizeof(dispArray1); i++) {
     dispArray1[i] = EEPROM.read(dispArray1Address + i);
   }
-  dispArray2[0] = EEPROM.read(dispArray2Address);
+  for (byte p = 1; p < NUM_DISPLAYS; p++) {
+    dispSelect[p] = EEPROM.read(panelSelectAddress(p));
+    dispSelect_prev[p] = 255;  // First update draws from scratch over the splash
+  }
   clockOffset = EEPROM.read(clockOffsetAddress); 
   EEPROM.get(odoAddress, odo);
   EEPROM.get(odoTripAddress, odoTrip);
   EEPROM.get(fuelSensorRawAddress, fuelSensorRaw);
   EEPROM.get(unitsAddress, units);
+  EEPROM.get(hallScaleAddress, hallScale);
+  if (!(hallScale > 0.8 && hallScale < 1.2)) {
+    hallScale = 1.0;  // Blank EEPROM (NaN) or implausible value
+  }
+  EEPROM.get(timebasePpmAddress, timebasePpm);
+  if (!(timebasePpm > -(float)TIMEBASE_MAX_PPM && timebasePpm < (float)TIMEBASE_MAX_PPM)) {
+    timebasePpm = 0;  // Blank EEPROM (NaN) or implausible value
+  }
+  timebaseApply();
 
   Serial.print("clockOffset: ");
   Serial.println(clockOffset);
   
   // ===== CAN BUS INITIALIZATION =====
-  if(CAN0.begin(MCP_ANY, CAN_500KBPS, MCP_8MHZ) == CAN_OK) 
+  // MCP_STDEXT keeps the acceptance masks and filters active (MCP_ANY bypasses them)
+  if(CAN0.begin(MCP_STDEXT, CAN_500KBPS, MCP_8MHZ) == CAN_OK) 
     Serial.println("MCP2515 Initialized Successfully!");
   else 
     Serial.println("Error Initializing MCP2515...");
@@ -264,6 +283,7 @@ void setup() {
   
   pinMode(CAN0_INT, INPUT);
   CAN0.setMode(MCP_NORMAL);
+  attachCANInterrupt();  // Frames are read as they arrive, parsed by serviceCAN()
 
   // ===== MOTOR UPDATE TIMER INITIALIZATION =====
   // Initialize Timer3 for deterministic motor stepping at MOTOR_UPDATE_FREQ_HZ
@@ -273,6 +293,7 @@ void setup() {
   // ===== SPLASH SCREEN DELAY =====
   while (millis() < SPLASH_TIME){
     // Wait for splash screen timer to expire
+    gpsConfigService();
   }
 
 }
@@ -317,10 +338,8 @@ void loop() {
   }
 
   // ===== CAN BUS RECEPTION =====
-  if(!digitalRead(CAN0_INT)) {
-    receiveCAN();
-    parseCAN(rxId, 0);
-  }
+  // Frames are read by the CAN0_INT interrupt (also between OLED transfer chunks); parse what it queued.
+  serviceCAN();
 
   // ===== OBDII POLLING =====
   // Poll ECU for parameters when using OBDII protocol
@@ -329,9 +348,10 @@ void loop() {
   }
 
   // ===== GPS DATA PROCESSING =====
-  if (millis() - timerCheckGPS > CHECK_GPS_RATE) {
+  gpsConfigService();  // No-op once the receiver set-up is complete
+  // Receive ISR raises gpsFixReady once per complete, checksum-valid fix
+  if (gpsFixReady) {
     fetchGPSdata();
-    timerCheckGPS = millis();
   }
 
   // ===== SERIAL COMMAND PROCESSING =====
@@ -395,39 +415,9 @@ void loop() {
   // Positioned AFTER motor angle updates to prevent blocking OLED operations
   // from delaying time-critical motor position updates
   // Each display uses independent timing with variable refresh rates based on content
-  
-  // Check for user input requiring immediate display update
-  bool needsImmediateUpdate = (button == 1) || encoderMoved;
-  
-  // Display 1 update - Variable refresh rate based on content type
-  // Update immediately on user input, or at scheduled interval
-  unsigned int disp1Interval = getDisplayUpdateInterval(dispArray1[0], 1);
-  if (needsImmediateUpdate || (millis() - timerDisp1Update > disp1Interval)) {
-    // Force a full redraw when the user scrolled to a new screen, so the display
-    // function always sees modeChanged=true and clears leftover content.
-    if (encoderMoved) {
-      dispArray1_prev[0] = 255;
-    }
-    dispMenu();
-    timerDisp1Update = millis();
-    encoderMoved = false;  // Clear flag after update
-  }
-  
-  // Display 2 update - Variable refresh rate based on content type
-  // Update immediately when selection changes (e.g., scrolling through Display 2 options in Settings)
-  // or when button is pressed (entering Display 2 submenu), or at scheduled interval for data refresh
-  bool disp2SelectionChanged = (dispArray2[0] != dispArray2_prev);
-  bool needsDisp2Update = disp2SelectionChanged || needsImmediateUpdate;
-  unsigned int disp2Interval = getDisplayUpdateInterval(dispArray2[0], 2);
-  if (needsDisp2Update || (millis() - timerDisp2Update > disp2Interval)) {
-    // Force a full redraw when the Display 2 selection changed, so the display
-    // function always sees modeChanged=true and clears leftover content.
-    if (disp2SelectionChanged) {
-      dispArray2_prev = 255;
-    }
-    disp2();
-    timerDisp2Update = millis();
-  }
+  // The flush arbiter updates at most one panel per pass: user input first, then the
+  // panel most overdue against its (governed) interval. See serviceDisplays().
+  serviceDisplays();
 
   // ===== FAULT DEBOUNCE + FLASH =====
   // Raw fault conditions are debounced: each must persist continuously for
@@ -457,15 +447,11 @@ void loop() {
     if (!fuelRaw)    { timerFuelFaultDebounce     = now; fuelFaultActive    = false; }
     else if (now - timerFuelFaultDebounce    >= FAULT_DEBOUNCE_MS) fuelFaultActive    = true;
 
-    // Determine which displays are showing a faulted reading
-    bool disp1Fault = (oilFaultActive     && (dispArray1[0] == 1)) ||
-                      (coolantFaultActive && (dispArray1[0] == 2)) ||
-                      (fuelFaultActive    && (dispArray1[0] == 3)) ||
-                      (battFaultActive    && (dispArray1[0] == 4));
-    bool disp2Fault = (oilFaultActive     && (dispArray2[0] == 0)) ||
-                      (coolantFaultActive && (dispArray2[0] == 1)) ||
-                      (fuelFaultActive    && (dispArray2[0] == 2)) ||
-                      (battFaultActive    && (dispArray2[0] == 3));
+    // Active faults; the screen registry binds them to the screens that flash
+    byte activeFaults = (oilFaultActive     ? FAULT_OIL     : 0) |
+                        (coolantFaultActive ? FAULT_COOLANT : 0) |
+                        (fuelFaultActive    ? FAULT_FUEL    : 0) |
+                        (battFaultActive    ? FAULT_BATT    : 0);
 
     // Toggle flash state every FAULT_FLASH_INTERVAL_MS
     if (millis() - timerFaultFlash >= FAULT_FLASH_INTERVAL_MS) {
@@ -474,17 +460,13 @@ void loop() {
     }
 
     // Apply hardware inversion only when the desired state changes, to minimize SPI traffic
-    static bool disp1InvertPrev = false;
-    static bool disp2InvertPrev = false;
-    bool disp1Invert = disp1Fault && faultFlashState;
-    bool disp2Invert = disp2Fault && faultFlashState;
-    if (disp1Invert != disp1InvertPrev) {
-      display1.invertDisplay(disp1Invert);
-      disp1InvertPrev = disp1Invert;
-    }
-    if (disp2Invert != disp2InvertPrev) {
-      display2.invertDisplay(disp2Invert);
-      disp2InvertPrev = disp2Invert;
+    static bool invertPrev[NUM_DISPLAYS];
+    for (byte p = 0; p < NUM_DISPLAYS; p++) {
+      bool invert = faultFlashState && (screenFault(p) & activeFaults) != 0;
+      if (invert != invertPrev[p]) {
+        displays[p].invertDisplay(invert);
+        invertPrev[p] = invert;
+      }
     }
   }
 
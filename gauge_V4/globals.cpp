@@ -8,8 +8,12 @@
 
 // ===== HARDWARE OBJECT INSTANCES =====
 MCP_CAN CAN0(CAN0_CS);
-Adafruit_SSD1306 display1(SCREEN_W, SCREEN_H, &SPI, OLED_DC_1, OLED_RST_1, OLED_CS_1);
-Adafruit_SSD1306 display2(SCREEN_W, SCREEN_H, &SPI, OLED_DC_2, OLED_RST_2, OLED_CS_2);
+uint8_t frameBuffer[SCREEN_W * SCREEN_H / 8];
+SharedBufferSSD1306 displays[NUM_DISPLAYS] = {
+  { SCREEN_W, SCREEN_H, &SPI, OLED_DC_1, OLED_RST_1, OLED_CS_1, frameBuffer },
+  { SCREEN_W, SCREEN_H, &SPI, OLED_DC_2, OLED_RST_2, OLED_CS_2, frameBuffer },
+};
+SharedBufferSSD1306 &display1 = displays[0];
 Rotary rotary = Rotary(2, 3);
 CRGB leds[MAX_LEDS];
 SwitecX12 motor1(M1_SWEEP, M1_STEP, M1_DIR);
@@ -19,7 +23,6 @@ SwitecX12 motor4(M4_SWEEP, M4_STEP, M4_DIR);
 SwitecX12 motorS(MS_SWEEP, MS_STEP, MS_DIR);
 // Note: odoMotor no longer uses Arduino Stepper library
 // Direct pin control is used in outputs.cpp for non-blocking operation
-Adafruit_GPS GPS(&Serial2);
 
 // ===== ANALOG SENSOR READINGS =====
 float vBatt = 12;              // Current battery voltage in volts (filtered)
@@ -36,11 +39,12 @@ float sensor_av3;              // Reserved sensor C value
 volatile unsigned long hallLastTime = 0;     // Last pulse time (micros)
 volatile float hallSpeedRaw = 0;             // Most recent calculated speed (MPH)
 unsigned int spdHall = 0;                    // Filtered speed (km/h * 100)
+float hallScale = 1.0;                       // Learned Hall correction vs GPS (loaded from EEPROM)
 
 // ===== ENGINE RPM SENSOR VARIABLES =====
 volatile unsigned long ignitionLastTime = 0; // Last ignition pulse time (micros)
-volatile int engineRPMRaw = 0;               // Most recent calculated RPM (unfiltered)
-volatile int engineRPMEMA = 0;               // Filtered RPM with exponential moving average
+int engineRPMRaw = 0;                        // Most recent calculated RPM (unfiltered)
+int engineRPMEMA = 0;                        // Filtered RPM with exponential moving average
 
 // ===== GPS SPEED AND ODOMETER VARIABLES =====
 // GPS provides speed and time data for speedometer and odometer calculations
@@ -50,7 +54,8 @@ unsigned long t_old = 0;       // Previous GPS timestamp (milliseconds)
 unsigned long t_new = 1;       // Current GPS timestamp (milliseconds)
 unsigned long v_100 = 0;       // Speed value * 100 for integer math precision
 float v = 0;                   // Current speed in km/h (floating point)
-bool usingInterrupt = false;   // Flag indicating if GPS uses interrupt-based reading
+bool fixGPS = false;           // Last GPS fix was valid (RMC status 'A')
+volatile bool gpsFixReady = false; // Set by GPS receive ISR when a new fix is published
 int lagGPS;                    // Time delay since last GPS update (milliseconds)
 int v_g;                       // GPS speed (alternate variable)
 float odo;                     // Total odometer reading in kilometers (saved to EEPROM)
@@ -77,7 +82,7 @@ volatile bool encoderMoved = false;    // Flag set when encoder rotates (for imm
 // Manage update rates for different subsystems
 unsigned long timer0, timerDispUpdate, timerCANsend;
 unsigned long timerSensorRead, timerTachUpdate, timerTachFlash;
-unsigned long timerCheckGPS, timerGPSupdate, timerAngleUpdate;
+unsigned long timerGPSupdate, timerAngleUpdate;
 unsigned long timerHallUpdate;
 unsigned long timerEngineRPMUpdate;
 unsigned long timerSigSelectUpdate;
@@ -108,6 +113,7 @@ int fuelCompCAN;           // Fuel composition (ethanol %) * 10 (e.g., 850 = 85.
 int fuelLvlCAN;            // Fuel level percentage (0-100)
 int baroCAN;               // Barometric pressure in kPa * 10 (sent TO other modules)
 int spdCAN;                // Vehicle speed sent to CAN bus (km/h * 16 for protocol compatibility)
+unsigned long spdCANTime = 0;  // millis() when spdCAN was last received (0 = never)
 int pumpPressureCAN;       // Fuel pump pressure (test variable)
 
 // ===== PROCESSED ENGINE PARAMETERS FOR DISPLAY =====
@@ -160,12 +166,15 @@ const uint8_t  fuelLvlTable_l[fuelLvlTable_length] = {160,  140,  120,  100,   8
 // ===== EEPROM STORAGE ADDRESSES =====
 // Non-volatile memory locations for saving settings between power cycles
 byte dispArray1Address = 0;      // Display 1 menu selections (4 bytes: addresses 0-3)
-byte dispArray2Address = 4;      // Display 2 selection (1 byte: address 4)
+byte dispSelectAddress = 4;      // Display 2 selection (1 byte: address 4)
 byte clockOffsetAddress = 5;     // Time zone offset for clock (1 byte: address 5)
 byte odoAddress = 6;             // Total odometer value (4 bytes: addresses 6-9)
 byte odoTripAddress = 10;        // Trip odometer value (4 bytes: addresses 10-13)
 byte fuelSensorRawAddress = 14;  // Last fuel sensor reading (for fuel level memory, addresses 14-17)
 byte unitsAddress = 18;          // Unit system selection: 0=metric, 1=imperial (1 byte: address 18)
+byte hallScaleAddress = 19;      // Learned Hall scale factor (float, addresses 19-22)
+byte timebasePpmAddress = 23;    // Measured millis() drift in ppm (float, addresses 23-26)
+byte dispSelectExtraAddress = 27; // Display 3+ selections (1 byte each: addresses 27 to 27 + NUM_DISPLAYS - 3)
 
 // ===== MENU NAVIGATION VARIABLES =====
 // Track current position in the multi-level menu system
@@ -173,7 +182,7 @@ byte menuLevel = 0;              // Current menu depth (0=top level, 1=submenu,
 byte units = 0;                  // Unit system: 0=metric (km/h, C, bar), 1=imperial (mph, F, PSI)
 unsigned int nMenuLevel = 17;    // Maximum menu index (0-17 = 18 total items)
 byte dispArray1[4] = { 1, 0, 0, 0 };  // Menu position array for display 1 [level0, level1, level2, level3]
-byte dispArray2[1] = {1};        // Menu selection for display 2 (single level)
+byte dispSelect[NUM_DISPLAYS];   // Screen selection per panel, loaded from EEPROM ([0] unused)
 
 // ===== DISPLAY OPTIMIZATION VARIABLES =====
 // Previous values for dirty tracking - detect when values change enough to warrant display update
@@ -193,13 +202,11 @@ int injDutyCAN_prev = 0;         // Previous injector duty for dirty tracking
 byte hour_prev = 0;              // Previous hour for clock dirty tracking
 byte minute_prev = 0;            // Previous minute for clock dirty tracking
 byte dispArray1_prev[4] = {0, 0, 0, 0}; // Previous display 1 menu state
-byte dispArray2_prev = 0;        // Previous display 2 selection
-bool staticContentDrawn1 = false; // Flag: static content drawn on display1
-bool staticContentDrawn2 = false; // Flag: static content drawn on display2
+byte dispSelect_prev[NUM_DISPLAYS];    // Previous screen selection per panel
+bool staticContentDrawn[NUM_DISPLAYS]; // Flag per panel: static content drawn
 
 // Variable refresh rate timers
-unsigned long timerDisp1Update = 0;  // Timer for display 1 updates
-unsigned long timerDisp2Update = 0;  // Timer for display 2 updates
+unsigned long timerDispPanel[NUM_DISPLAYS];  // Last update time per panel
 
 // ===== FAULT FLASH STATE =====
 unsigned long timerFaultFlash = 0;   // Timer for fault display flash toggle
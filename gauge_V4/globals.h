@@ -12,7 +12,6 @@
 
 #include <Arduino.h>
 #include <Adafruit_SSD1306.h>
-#include <Adafruit_GPS.h>
 #include <mcp_can.h>
 #include <SwitecX12.h>
 #define HALF_STEP
@@ -20,11 +19,13 @@
 #include <FastLED.h>
 #include "config_hardware.h"
 #include "config_calibration.h"
+#include "display.h"
 
 // ===== HARDWARE OBJECT INSTANCES =====
 extern MCP_CAN CAN0;
-extern Adafruit_SSD1306 display1;
-extern Adafruit_SSD1306 display2;
+extern uint8_t frameBuffer[SCREEN_W * SCREEN_H / 8];  // Render buffer shared by every panel
+extern SharedBufferSSD1306 displays[NUM_DISPLAYS];     // OLED panels; index = display number - 1
+extern SharedBufferSSD1306 &display1;                  // displays[0], the menu display
 extern Rotary rotary;
 extern CRGB leds[MAX_LEDS];
 extern SwitecX12 motor1;
@@ -34,7 +35,6 @@ extern SwitecX12 motor4;
 extern SwitecX12 motorS;
 // Note: odoMotor no longer uses Arduino Stepper library
 // Direct pin control is used in outputs.cpp for non-blocking operation
-extern Adafruit_GPS GPS;
 
 // ===== ANALOG SENSOR READINGS =====
 extern float vBatt;                 // Current battery voltage in volts (filtered)
@@ -51,11 +51,12 @@ extern float sensor_av3;            // Reserved sensor C value
 extern volatile unsigned long hallLastTime;     // Last pulse time (micros)
 extern volatile float hallSpeedRaw;             // Most recent calculated speed (MPH)
 extern unsigned int spdHall;                    // Filtered speed (km/h * 100)
+extern float hallScale;                         // Learned Hall correction vs GPS (1.0 = REVS_PER_KM exact)
 
 // ===== ENGINE RPM SENSOR VARIABLES =====
 extern volatile unsigned long ignitionLastTime; // Last ignition pulse time (micros)
-extern volatile int engineRPMRaw;               // Most recent calculated RPM (unfiltered)
-extern volatile int engineRPMEMA;               // Filtered RPM with exponential moving average
+extern int engineRPMRaw;                        // Most recent calculated RPM (unfiltered)
+extern int engineRPMEMA;                        // Filtered RPM with exponential moving average
 
 // ===== GPS SPEED AND ODOMETER VARIABLES =====
 extern unsigned long v_old;         // Previous GPS speed reading (km/h * 100)
@@ -64,7 +65,8 @@ extern unsigned long t_old;         // Previous GPS timestamp (milliseconds)
 extern unsigned long t_new;         // Current GPS timestamp (milliseconds)
 extern unsigned long v_100;         // Speed value * 100 for integer math precision
 extern float v;                     // Current speed in km/h (floating point)
-extern bool usingInterrupt;         // Flag indicating if GPS uses interrupt-based reading
+extern bool fixGPS;                 // Last GPS fix was valid (RMC status 'A')
+extern volatile bool gpsFixReady;   // Set by GPS receive ISR when a new fix is published
 extern int lagGPS;                  // Time delay since last GPS update (milliseconds)
 extern int v_g;                     // GPS speed (alternate variable)
 extern float odo;                   // Total odometer reading in kilometers (saved to EEPROM)
@@ -85,7 +87,7 @@ extern volatile bool encoderMoved;  // Flag set when encoder rotates (for immedi
 // ===== TIMING VARIABLES =====
 extern unsigned long timer0, timerDispUpdate, timerCANsend;
 extern unsigned long timerSensorRead, timerTachUpdate, timerTachFlash;
-extern unsigned long timerCheckGPS, timerGPSupdate, timerAngleUpdate;
+extern unsigned long timerGPSupdate, timerAngleUpdate;
 extern unsigned long timerHallUpdate;
 extern unsigned long timerEngineRPMUpdate;
 extern unsigned long timerSigSelectUpdate;
@@ -109,6 +111,7 @@ extern int fuelCompCAN;             // Fuel composition (ethanol %) * 10
 extern int fuelLvlCAN;              // Fuel level percentage (0-100)
 extern int baroCAN;                 // Barometric pressure in kPa * 10
 extern int spdCAN;                  // Vehicle speed sent to CAN bus (km/h * 16)
+extern unsigned long spdCANTime;    // millis() when spdCAN was last received
 extern int pumpPressureCAN;         // Fuel pump pressure (test variable)
 
 // ===== OBDII POLLING VARIABLES =====
@@ -153,19 +156,22 @@ extern const uint8_t  fuelLvlTable_l[]; // Gallons * 10 remaining
 
 // ===== EEPROM STORAGE ADDRESSES =====
 extern byte dispArray1Address;      // Display 1 menu selections (4 bytes)
-extern byte dispArray2Address;      // Display 2 selection (1 byte)
+extern byte dispSelectAddress;      // Display 2 selection (1 byte)
+extern byte dispSelectExtraAddress; // Display 3+ selections (1 byte each)
 extern byte clockOffsetAddress;     // Time zone offset for clock (1 byte)
 extern byte odoAddress;             // Total odometer value (4 bytes)
 extern byte odoTripAddress;         // Trip odometer value (4 bytes)
 extern byte fuelSensorRawAddress;   // Last fuel sensor reading (4 bytes)
 extern byte unitsAddress;           // Unit system selection (1 byte)
+extern byte hallScaleAddress;       // Learned Hall scale factor (4 bytes)
+extern byte timebasePpmAddress;     // Measured millis() drift in ppm (4 bytes)
 
 // ===== MENU NAVIGATION VARIABLES =====
 extern byte menuLevel;              // Current menu depth
 extern byte units;                  // Unit system: 0=metric, 1=imperial
 extern unsigned int nMenuLevel;     // Number of items in current menu level
 extern byte dispArray1[4];          // Menu position array for display 1
-extern byte dispArray2[1];          // Menu selection for display 2
+extern byte dispSelect[NUM_DISPLAYS];  // Screen selection per panel ([0] unused: display 1 follows dispArray1)
 
 // ===== DISPLAY OPTIMIZATION VARIABLES =====
 // Previous values for dirty tracking
@@ -185,13 +191,11 @@ extern int injDutyCAN_prev;         // Previous injector duty for dirty tracking
 extern byte hour_prev;              // Previous hour for clock dirty tracking
 extern byte minute_prev;            // Previous minute for clock dirty tracking
 extern byte dispArray1_prev[4];     // Previous display 1 menu state
-extern byte dispArray2_prev;        // Previous display 2 selection
-extern bool staticContentDrawn1;    // Flag: static content drawn on display1
-extern bool staticContentDrawn2;    // Flag: static content drawn on display2
+extern byte dispSelect_prev[NUM_DISPLAYS];       // Previous screen selection per panel
+extern bool staticContentDrawn[NUM_DISPLAYS];    // Flag per panel: static content drawn
 
 // Variable refresh rate timers
-extern unsigned long timerDisp1Update;  // Timer for display 1 updates
-extern unsigned long timerDisp2Update;  // Timer for display 2 updates
+extern unsigned long timerDispPanel[NUM_DISPLAYS];  // Last update time per panel
 
 // ===== FAULT FLASH STATE =====
 extern unsigned long timerFaultFlash;   // Timer for fault display flash toggle
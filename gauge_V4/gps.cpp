@@ -8,102 +8,508 @@
 #include "globals.h"
 #include "sensors.h"
 #include "outputs.h"
+#include "timebase.h"
+
+// ===== STREAMING NMEA PARSER STATE =====
+// Byte-at-a-time RMC/VTG decoder: no line buffer, checksum accumulated as bytes arrive.
+// Only fields of interest are decoded; everything else is skipped in place.
+enum NmeaState : uint8_t { NMEA_IDLE, NMEA_BODY, NMEA_CK_HI, NMEA_CK_LO };
+enum NmeaType : uint8_t { NMEA_OTHER, NMEA_RMC, NMEA_VTG };
+
+static NmeaState nmeaState = NMEA_IDLE;
+static NmeaType nmeaType = NMEA_OTHER;
+static uint8_t nmeaChecksum = 0;      // Running XOR of bytes between '$' and '*'
+static uint8_t nmeaChecksumRx = 0;    // Checksum received after '*'
+static uint8_t nmeaField = 0;         // Field index (0 = talker + sentence type)
+static uint8_t nmeaFieldPos = 0;      // Character position within field
+static uint8_t nmeaSpeedField = 0xFF; // Field holding speed in knots for this sentence type
+static uint32_t nmeaValue = 0;        // Field accumulator (sentence type code, or speed digits)
+static int8_t nmeaFracDigits = -1;    // Digits after '.', -1 = no '.' seen yet
+
+// Fields of the sentence in progress - committed only when the checksum matches
+static uint16_t nmeaSpeedCK = 0;      // Speed in centi-knots
+static uint8_t nmeaHour = 0, nmeaMinute = 0, nmeaSecond = 0, nmeaCenti = 0;
+static bool nmeaValid = false;        // RMC status 'A' / VTG mode 'A' or 'D'
+
+// Published fix (written in receive path, read by fetchGPSdata(); gpsFixReady is global)
+static volatile unsigned long fixStampMs = 0;  // millis() at start of the fix's sentence/frame
+static unsigned long sentenceStartMs = 0;      // millis() at the current '$' / UBX sync
+static volatile uint16_t fixSpeedCK = 0;
+static volatile uint8_t fixHour = 0, fixMinute = 0;
+static volatile unsigned long fixTimeMs = 0;  // Fix time: ms of UTC day (NMEA) or GPS time of week (UBX iTOW)
+static volatile bool fixTimed = false;          // Fix carried a time stamp (VTG does not)
+static volatile bool fixValid = false;
+static bool gpsSlopeValid = false;  // Last two fixes both valid, so spdGPS - v_old is a real acceleration
+
+/**
+ * nmeaEndField - Finish the current field of the sentence being parsed
+ */
+static void nmeaEndField() {
+  if (nmeaField == 0) {
+    // Last three characters of "GPRMC" / "GNVTG" etc. identify the sentence
+    uint32_t code = nmeaValue & 0xFFFFFFUL;
+    if (code == (((uint32_t)'R' << 16) | ('M' << 8) | 'C')) {
+      nmeaType = NMEA_RMC;
+      nmeaSpeedField = 7;
+    } else if (code == (((uint32_t)'V' << 16) | ('T' << 8) | 'G')) {
+      nmeaType = NMEA_VTG;
+      nmeaSpeedField = 5;
+    }
+  } else if (nmeaField == nmeaSpeedField) {
+    // Scale to hundredths regardless of how many decimals the receiver sent
+    uint32_t val = nmeaValue;
+    if (nmeaFracDigits <= 0) {
+      val *= 100;
+    } else if (nmeaFracDigits == 1) {
+      val *= 10;
+    }
+    nmeaSpeedCK = (val > 0xFFFF) ? 0xFFFF : (uint16_t)val;
+  }
+  nmeaField++;
+  nmeaFieldPos = 0;
+  nmeaValue = 0;
+  nmeaFracDigits = -1;
+}
+
+/**
+ * nmeaHexValue - Convert one checksum hex character to 0-15
+ */
+static inline uint8_t nmeaHexValue(uint8_t c) {
+  return (c <= '9') ? (c - '0') : ((c & 0x07) + 9);
+}
+
+/**
+ * nmeaParseByte - Feed one received byte into the NMEA state machine
+ */
+static void nmeaParseByte(uint8_t c) {
+  if (c == '$') {
+    sentenceStartMs = millis();  // Arrival time of this fix, free of main-loop jitter
+    nmeaState = NMEA_BODY;
+    nmeaType = NMEA_OTHER;
+    nmeaChecksum = 0;
+    nmeaField = 0;
+    nmeaFieldPos = 0;
+    nmeaSpeedField = 0xFF;
+    nmeaValue = 0;
+    nmeaFracDigits = -1;
+    nmeaSpeedCK = 0;
+    nmeaCenti = 0;
+    nmeaValid = false;
+    return;
+  }
+
+  switch (nmeaState) {
+    case NMEA_IDLE:
+      return;
+
+    case NMEA_BODY:
+      if (c == '*') {
+        nmeaEndField();
+        nmeaState = NMEA_CK_HI;
+        return;
+      }
+      if (c == '\r' || c == '\n') {
+        nmeaState = NMEA_IDLE;  // Sentence without checksum - reject
+        return;
+      }
+      nmeaChecksum ^= c;
+      if (c == ',') {
+        nmeaEndField();
+        return;
+      }
+      if (nmeaField == 0) {
+        nmeaValue = (nmeaValue << 8) | c;  // Sentence type code
+      } else if (nmeaField == nmeaSpeedField) {
+        if (c >= '0' && c <= '9') {
+          if (nmeaFracDigits < 0) {
+            nmeaValue = nmeaValue * 10 + (c - '0');
+          } else if (nmeaFracDigits < 2) {
+            nmeaValue = nmeaValue * 10 + (c - '0');
+            nmeaFracDigits++;
+          }
+        } else if (c == '.') {
+          nmeaFracDigits = 0;
+        }
+      } else if (nmeaType == NMEA_RMC && nmeaField == 1) {
+        // UTC time hhmmss.ss - decode digits by position, no division needed
+        uint8_t d = c - '0';
+        switch (nmeaFieldPos) {
+          case 0: nmeaHour = d * 10; break;
+          case 1: nmeaHour += d; break;
+          case 2: nmeaMinute = d * 10; break;
+          case 3: nmeaMinute += d; break;
+          case 4: nmeaSecond = d * 10; break;
+          case 5: nmeaSecond += d; break;
+          case 7: nmeaCenti = d * 10; break;
+          case 8: nmeaCenti += d; break;
+        }
+      } else if ((nmeaType == NMEA_RMC && nmeaField == 2) ||
+                 (nmeaType == NMEA_VTG && nmeaField == 9)) {
+        nmeaValid = (c == 'A' || c == 'D');  // RMC status / VTG mode indicator
+      }
+      nmeaFieldPos++;
+      return;
+
+    case NMEA_CK_HI:
+      nmeaChecksumRx = nmeaHexValue(c) << 4;
+      nmeaState = NMEA_CK_LO;
+      return;
+
+    case NMEA_CK_LO:
+      nmeaChecksumRx |= nmeaHexValue(c);
+      nmeaState = NMEA_IDLE;
+      if (nmeaChecksumRx != nmeaChecksum || nmeaType == NMEA_OTHER) {
+        return;
+      }
+      // Publish; VTG carries no time so the last RMC time is kept
+      fixSpeedCK = nmeaSpeedCK;
+      fixValid = nmeaValid;
+      fixTimed = (nmeaType == NMEA_RMC);
+      if (fixTimed) {
+        fixHour = nmeaHour;
+        fixMinute = nmeaMinute;
+        fixTimeMs = ((nmeaHour * 60UL + nmeaMinute) * 60UL + nmeaSecond) * 1000UL + nmeaCenti * 10U;
+      }
+      fixStampMs = sentenceStartMs;
+      gpsFixReady = true;
+      return;
+  }
+}
+
+// ===== UBX BINARY DECODER STATE (GPS_PROTOCOL_UBX) =====
+// Frame: 0xB5 0x62 class id len(2, LE) payload ckA ckB (Fletcher-8 over class..payload).
+// Only NAV-PVT is decoded; fields are picked out by payload offset as they stream past.
+enum UbxState : uint8_t { UBX_SYNC1, UBX_SYNC2, UBX_CLASS, UBX_ID, UBX_LEN1, UBX_LEN2, UBX_PAYLOAD, UBX_CK_A, UBX_CK_B };
+
+constexpr uint8_t UBX_CLASS_NAV = 0x01;
+constexpr uint8_t UBX_ID_NAV_PVT = 0x07;
+constexpr uint16_t UBX_NAV_PVT_LEN = 92;
+
+static UbxState ubxState = UBX_SYNC1;
+static uint8_t ubxCkA = 0, ubxCkB = 0;  // Running Fletcher checksum
+static bool ubxIsPvt = false;           // Current frame is NAV-PVT
+static uint16_t ubxLength = 0;          // Payload length from header
+static uint16_t ubxIndex = 0;           // Payload byte index
+
+// Fields of the frame in progress - committed only when the checksum matches
+static uint8_t ubxHour = 0, ubxMinute = 0;
+static uint8_t ubxFixType = 0, ubxFlags = 0;
+static uint32_t ubxGroundSpeed = 0;     // gSpeed, mm/s
+static uint32_t ubxTimeOfWeek = 0;      // iTOW, ms
+
+/**
+ * ubxParseByte - Feed one received byte into the UBX frame decoder
+ */
+static void ubxParseByte(uint8_t c) {
+  if (ubxState >= UBX_CLASS && ubxState <= UBX_PAYLOAD) {
+    ubxCkA += c;
+    ubxCkB += ubxCkA;
+  }
+
+  switch (ubxState) {
+    case UBX_SYNC1:
+      if (c == 0xB5) {
+        sentenceStartMs = millis();  // Arrival time of this fix, free of main-loop jitter
+        ubxState = UBX_SYNC2;
+      }
+      return;
+    case UBX_SYNC2:
+      ubxState = (c == 0x62) ? UBX_CLASS : UBX_SYNC1;
+      ubxCkA = 0;
+      ubxCkB = 0;
+      return;
+    case UBX_CLASS:
+      ubxIsPvt = (c == UBX_CLASS_NAV);
+      ubxState = UBX_ID;
+      return;
+    case UBX_ID:
+      ubxIsPvt = ubxIsPvt && (c == UBX_ID_NAV_PVT);
+      ubxState = UBX_LEN1;
+      return;
+    case UBX_LEN1:
+      ubxLength = c;
+      ubxState = UBX_LEN2;
+      return;
+    case UBX_LEN2:
+      ubxLength |= (uint16_t)c << 8;
+      ubxIsPvt = ubxIsPvt && (ubxLength == UBX_NAV_PVT_LEN);
+      ubxIndex = 0;
+      ubxState = (ubxLength > 0) ? UBX_PAYLOAD : UBX_CK_A;
+      return;
+    case UBX_PAYLOAD:
+      if (ubxIsPvt) {
+        switch (ubxIndex) {
+          case 0:  ubxTimeOfWeek = c; break;
+          case 1:  ubxTimeOfWeek |= (uint32_t)c << 8; break;
+          case 2:  ubxTimeOfWeek |= (uint32_t)c << 16; break;
+          case 3:  ubxTimeOfWeek |= (uint32_t)c << 24; break;
+          case 8:  ubxHour = c; break;
+          case 9:  ubxMinute = c; break;
+          case 20: ubxFixType = c; break;
+          case 21: ubxFlags = c; break;
+          case 60: ubxGroundSpeed = c; break;
+          case 61: ubxGroundSpeed |= (uint32_t)c << 8; break;
+          case 62: ubxGroundSpeed |= (uint32_t)c << 16; break;
+          case 63: ubxGroundSpeed |= (uint32_t)c << 24; break;
+        }
+      }
+      if (++ubxIndex >= ubxLength) {
+        ubxState = UBX_CK_A;
+      }
+      return;
+    case UBX_CK_A:
+      ubxState = (c == ubxCkA) ? UBX_CK_B : UBX_SYNC1;
+      return;
+    case UBX_CK_B:
+      ubxState = UBX_SYNC1;
+      if (c != ubxCkB || !ubxIsPvt) {
+        return;
+      }
+      {
+        // gSpeed is signed but never negative in practice; clamp to 540 km/h
+        uint32_t mmps = (ubxGroundSpeed > 150000UL) ? 150000UL : ubxGroundSpeed;
+        // mm/s -> centi-knots: x / 5.14444 ≈ (x * 25477) >> 17
+        fixSpeedCK = (uint16_t)((mmps * 25477UL) >> 17);
+      }
+      fixValid = (ubxFlags & 0x01) && ubxFixType >= 2;  // gnssFixOK and 2D/3D fix
+      fixHour = ubxHour;
+      fixMinute = ubxMinute;
+      fixTimeMs = ubxTimeOfWeek;
+      fixTimed = true;
+      fixStampMs = sentenceStartMs;
+      gpsFixReady = true;
+      return;
+  }
+}
 
 /**
  * fetchGPSdata - Process new GPS data when available
  */
 void fetchGPSdata(){
-  if (GPS.newNMEAreceived()) {
-    if (!GPS.parse(GPS.lastNMEA()))   // Parse NMEA sentence; also clears newNMEAreceived flag
-    return;  // If parse fails (corrupt data), wait for next sentence
+  if (!gpsFixReady) {
+    return;
+  }
+
+  // Snapshot the published fix (written in interrupt context)
+  noInterrupts();
+  uint16_t speedCK = fixSpeedCK;
+  bool valid = fixValid;
+  byte fixHourCopy = fixHour;
+  byte fixMinuteCopy = fixMinute;
+  unsigned long stamp = fixStampMs;
+  unsigned long timeMs = fixTimeMs;
+  bool timed = fixTimed;
+  gpsFixReady = false;
+  interrupts();
+
+  constexpr unsigned int ALPHA_GPS = 256;  // Filter coefficient (256 = no filtering, instant response)
+  
+  // Save previous values for interpolation
+  t_old = t_new;        // Previous timestamp
+  t_new = stamp;        // Fix arrival time captured in the receive ISR
+  v_old = spdGPS;       // Previous filtered speed
+  lagGPS = t_new - t_old; // Time between GPS updates (typically 100ms at 10Hz)
+  gpsSlopeValid = valid && fixGPS;  // After a no-fix sentence v_old is 0, not a measured speed
+  fixGPS = valid;
   
-    //if (millis() - timerGPSupdate > GPS_UPDATE_RATE) {  // Optional rate limiting (currently disabled)
-      //timerGPSupdate = millis();
-      
-            constexpr unsigned int ALPHA_GPS = 256;  // Filter coefficient (256 = no filtering, instant response)
-            
-            // Save previous values for interpolation
-            t_old = t_new;        // Previous timestamp
-            t_new = millis();     // Current timestamp
-            v_old = spdGPS;       // Previous filtered speed
-            lagGPS = t_new - t_old; // Time between GPS updates (typically 200ms at 5Hz)
-            
-            // Get speed from GPS and convert units
-            v = GPS.speed * 1.852;           // Convert knots to km/h (1 knot = 1.852 km/h)
-            float vFloat = GPS.speed * 185.2;  // Speed * 100 for precision (km/h * 100)
-            v_100 = (unsigned long)vFloat;   // Convert to integer
-            
-            // Apply exponential filter for smooth speedometer
-            spdGPS = (v_100 * ALPHA_GPS + v_old * (256 - ALPHA_GPS)) >> 8;  // Weighted average (>>8 = /256)
-            
-            // Calculate distance traveled for odometer (only if GPS is selected as speed source)
-            if (SPEED_SOURCE == 3) {
-              distLast = updateOdometer(v, lagGPS);
-              if (distLast > 0) {
-                moveOdometerMotor(distLast);
-              }
-            } else {
-              // Still calculate distLast for potential display/debugging, but don't update odometer
-              if (v > 2) {
-                distLast = v * lagGPS * 2.77778e-7;
-              } else {
-                distLast = 0;
-              }
-            }
-            
-            // Extract time from GPS (UTC)
-            hour = GPS.hour;
-            minute = GPS.minute;          
-      //}
+  // Convert centi-knots to km/h * 100 with integer math (1 knot = 1.852 km/h)
+  // No fix: report zero rather than the receiver's last speed
+  v_100 = valid ? ((unsigned long)speedCK * 1852UL + 500UL) / 1000UL : 0;
+  v = v_100 * 0.01;     // km/h as float for updateOdometer()
+  
+  // Apply exponential filter for smooth speedometer
+  spdGPS = (v_100 * ALPHA_GPS + v_old * (256 - ALPHA_GPS)) >> 8;  // Weighted average (>>8 = /256)
+  
+  // Calculate distance traveled for odometer (only if GPS is selected as speed source)
+  if (SPEED_SOURCE == 3) {
+    distLast = updateOdometer(v, lagGPS);
+    if (distLast > 0) {
+      moveOdometerMotor(distLast);
+    }
+  } else {
+    // Still calculate distLast for potential display/debugging, but don't update odometer
+    if (v > 2) {
+      distLast = v * lagGPS * timebaseKmPerKmhMs;
+    } else {
+      distLast = 0;
+    }
   }
+  
+  // Discipline millis() against the receiver's clock
+  if (valid && timed) {
+    constexpr unsigned long GPS_TIME_WRAP_MS = (GPS_PROTOCOL == GPS_PROTOCOL_UBX) ? 604800000UL : 86400000UL;
+    timebaseUpdate(timeMs, stamp, GPS_TIME_WRAP_MS);
+  }
+
+  // Extract time from GPS (UTC)
+  hour = fixHourCopy;
+  minute = fixMinuteCopy;
 }
 
 /**
- * TIMER0_COMPA_vect - Timer0 compare interrupt for GPS data reading
- * 
- * ISR Design: Minimal - single byte read from GPS UART
- * - Called automatically ~1 kHz by Timer0 (shared with millis())
- * - Reads one byte from GPS module via Adafruit_GPS library
- * - No parsing, no processing - just captures data
- * - Heavy parsing deferred to fetchGPSdata() in main loop
- * 
- * Performance: ~3-5 µs execution time (just UART read)
- * 
- * This interrupt service routine (ISR) is called automatically once per millisecond
- * by the Arduino Timer0 hardware timer. It reads one byte from the GPS module
- * without blocking the main loop.
+ * gpsSpeedNow - GPS speed dead-reckoned to the current time
+ */
+unsigned long gpsSpeedNow() {
+  // No fix, or fix interval too long to trust the slope: report the last fix as-is
+  if (!fixGPS || lagGPS <= 0 || (unsigned int)lagGPS > GPS_STALE_MS) {
+    return spdGPS;
+  }
+
+  // No slope without two valid fixes
+  if (!gpsSlopeValid) {
+    return spdGPS;
+  }
+
+  // Extrapolate along the last measured acceleration, then hold once the horizon is reached
+  unsigned long age = min(millis() - t_new, (unsigned long)GPS_EXTRAPOLATE_MS);
+
+  long slope = (long)spdGPS - (long)v_old;  // km/h*100 gained over lagGPS ms
+  long est = (long)spdGPS + (slope * (long)age) / lagGPS;
+  return (unsigned long)constrain(est, 0L, GPS_SPEED_MAX);
+}
+
+// ===== GPS UART (USART2) =====
+// PMTK commands stored in flash; '$' and '*XX' checksum are added by gpsSendCommand()
+static const char PMTK_SET_BAUD[] PROGMEM = "PMTK251,38400";       // Must match GPS_BAUD
+static const char PMTK_OUTPUT_RMC[] PROGMEM = "PMTK314,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0";  // RMC only
+static const char PMTK_UPDATE_10HZ[] PROGMEM = "PMTK220,100";      // 100 ms output period
+static const char PMTK_FIX_CTL_10HZ[] PROGMEM = "PMTK300,100,0,0,0,0";  // 100 ms fix period
+
+// UBX configuration payloads (u-blox receivers, GPS_PROTOCOL_UBX)
+// CFG-PRT UART1: 8N1, GPS_BAUD (38400 = 0x9600), UBX in/out only
+static const uint8_t UBX_CFG_PRT[] PROGMEM = {
+  0x01, 0x00, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x00,
+  0x00, 0x96, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00 };
+static const uint8_t UBX_CFG_MSG_PVT[] PROGMEM = { UBX_CLASS_NAV, UBX_ID_NAV_PVT, 0x01 };  // NAV-PVT every epoch
+static const uint8_t UBX_CFG_RATE_10HZ[] PROGMEM = { 0x64, 0x00, 0x01, 0x00, 0x00, 0x00 }; // 100 ms, UTC aligned
+
+/**
+ * gpsUartInit - Configure USART2 for 8N1 at the given baud with RX interrupt
+ */
+static void gpsUartInit(unsigned long baud) {
+  UCSR2B = 0;                                       // Disable while reconfiguring
+  UCSR2A = _BV(U2X2);                               // Double speed: lower baud error at 38400
+  UBRR2 = (uint16_t)((F_CPU / (8UL * baud)) - 1);
+  UCSR2C = _BV(UCSZ21) | _BV(UCSZ20);               // 8 data bits, no parity, 1 stop
+  UCSR2B = _BV(RXEN2) | _BV(TXEN2) | _BV(RXCIE2);   // RX, TX, RX complete interrupt
+}
+
+/**
+ * gpsWriteByte - Blocking single-byte transmit (setup only)
+ */
+static void gpsWriteByte(uint8_t c) {
+  while (!(UCSR2A & _BV(UDRE2))) {}
+  UDR2 = c;
+}
+
+/**
+ * gpsSendCommand - Send a PMTK sentence body from flash with '$' and checksum
+ */
+static void gpsSendCommand(const char* bodyP) {
+  static const char HEX_DIGITS[] = "0123456789ABCDEF";
+  uint8_t checksum = 0;
+  gpsWriteByte('$');
+  for (uint8_t c = pgm_read_byte(bodyP); c != 0; c = pgm_read_byte(++bodyP)) {
+    checksum ^= c;
+    gpsWriteByte(c);
+  }
+  gpsWriteByte('*');
+  gpsWriteByte(HEX_DIGITS[checksum >> 4]);
+  gpsWriteByte(HEX_DIGITS[checksum & 0x0F]);
+  gpsWriteByte('\r');
+  gpsWriteByte('\n');
+  while (!(UCSR2A & _BV(UDRE2))) {}  // Let the last byte leave the data register
+}
+
+/**
+ * gpsSendUbx - Send a UBX frame with payload from flash; checksum computed on the fly
+ */
+static void gpsSendUbx(uint8_t msgClass, uint8_t msgId, const uint8_t* payloadP, uint8_t length) {
+  uint8_t ckA = 0, ckB = 0;
+  uint8_t header[4] = { msgClass, msgId, length, 0 };
+  gpsWriteByte(0xB5);
+  gpsWriteByte(0x62);
+  for (uint8_t i = 0; i < 4; i++) {
+    ckA += header[i];
+    ckB += ckA;
+    gpsWriteByte(header[i]);
+  }
+  for (uint8_t i = 0; i < length; i++) {
+    uint8_t c = pgm_read_byte(payloadP + i);
+    ckA += c;
+    ckB += ckA;
+    gpsWriteByte(c);
+  }
+  gpsWriteByte(ckA);
+  gpsWriteByte(ckB);
+  while (!(UCSR2A & _BV(UDRE2))) {}
+}
+
+static unsigned long gpsConfigStartMs = 0;  // millis() when the baud switch command went out
+static bool gpsConfigPending = false;       // Rate/output commands still to send at GPS_BAUD
+
+/**
+ * gpsBegin - Bring up the GPS UART and ask the receiver to switch to GPS_BAUD
+ */
+void gpsBegin() {
+  // Receiver boots at GPS_BAUD_DEFAULT; if it kept GPS_BAUD from battery-backed RAM
+  // this command is simply ignored and gpsConfigService()'s commands still land
+  gpsUartInit(GPS_BAUD_DEFAULT);
+  if (GPS_PROTOCOL == GPS_PROTOCOL_UBX) {
+    gpsSendUbx(0x06, 0x00, UBX_CFG_PRT, sizeof(UBX_CFG_PRT));   // CFG-PRT
+  } else {
+    gpsSendCommand(PMTK_SET_BAUD);
+  }
+  gpsConfigStartMs = millis();
+  gpsConfigPending = true;
+}
+
+/**
+ * gpsConfigService - Finish receiver set-up once its baud switch has settled
+ */
+void gpsConfigService() {
+  if (!gpsConfigPending || millis() - gpsConfigStartMs < GPS_BAUD_SWITCH_MS) {
+    return;
+  }
+  gpsConfigPending = false;
+  gpsUartInit(GPS_BAUD);
+  if (GPS_PROTOCOL == GPS_PROTOCOL_UBX) {
+    gpsSendUbx(0x06, 0x01, UBX_CFG_MSG_PVT, sizeof(UBX_CFG_MSG_PVT));     // CFG-MSG
+    gpsSendUbx(0x06, 0x08, UBX_CFG_RATE_10HZ, sizeof(UBX_CFG_RATE_10HZ)); // CFG-RATE
+  } else {
+    gpsSendCommand(PMTK_OUTPUT_RMC);
+    gpsSendCommand(PMTK_UPDATE_10HZ);
+    gpsSendCommand(PMTK_FIX_CTL_10HZ);
+  }
+}
+
+/**
+ * USART2_RX_vect - GPS receive interrupt
  * 
- * The GPS module sends NMEA sentences at 9600 baud (960 characters/second).
- * This ISR ensures no characters are missed even when main loop is busy.
+ * ISR Design: One byte per interrupt, parsed in place
+ * - Fires only when a byte arrives (no cost while the UART is idle)
+ * - Feeds the byte straight into the streaming NMEA or UBX parser, which keeps
+ *   its own state, so no RX ring buffer is needed
  * 
- * Interrupt context: Keep fast and simple - just read one character
+ * Performance: ~4-7 µs per byte (~0.4% CPU for RMC at 10 Hz)
  * 
- * Note: Original comment preserved - this is boilerplate code from Adafruit GPS library
+ * WARNING: Serial2 must not be used anywhere - the core's Serial2 RX ISR
+ * would clash with this vector at link time.
  */
-SIGNAL(TIMER0_COMPA_vect) {
-  char c = GPS.read();  // Read one byte from GPS module
+ISR(USART2_RX_vect) {
+  uint8_t c = UDR2;
+  // Streaming parse - fix is published on a valid checksum
+  if (GPS_PROTOCOL == GPS_PROTOCOL_UBX) {
+    ubxParseByte(c);
+  } else {
+    nmeaParseByte(c);
+  }
   // Debug option: echo GPS data to serial (very slow - only for debugging)
 #ifdef UDR0  // Check if UART data register is defined (AVR specific)
   if (GPSECHO)
-    if (c) UDR0 = c;  // Write directly to UART register (faster than Serial.print)
+    UDR0 = c;  // Write directly to UART register (faster than Serial.print)
     // Writing direct to UDR0 is much faster than Serial.print 
     // but only one character can be written at a time
 #endif
 }
-
-/**
- * useInterrupt - Enable or disable GPS interrupt-based reading
- */
-void useInterrupt(boolean v) {
-  if (v) {
-    // Enable GPS reading via Timer0 interrupt
-    // Timer0 is already used for millis() - we add our interrupt to it
-    OCR0A = 0xAF;  // Set compare value (when timer reaches this, interrupt fires)
-    TIMSK0 |= _BV(OCIE0A);  // Enable Timer0 Compare A interrupt
-    usingInterrupt = true;
-  } else {
-    // Disable GPS interrupt
-    TIMSK0 &= ~_BV(OCIE0A);  // Disable Timer0 Compare A interrupt
-    usingInterrupt = false;
-  }
-}
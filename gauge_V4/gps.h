@@ -4,7 +4,7 @@
  * ========================================
  * 
  * Handle GPS data acquisition for speedometer, odometer, and clock
- * Uses Adafruit GPS module with interrupt-based data collection
+ * Uses USART2 receive interrupt with a streaming NMEA parser
  */
 
 #ifndef GPS_H
@@ -15,14 +15,18 @@
 /**
  * fetchGPSdata - Process new GPS data when available
  * 
- * Parses NMEA sentences from GPS module and updates speed, odometer, and time.
- * Uses filtering and interpolation for smooth speedometer response.
+ * Consumes the fix published by the streaming NMEA parser and updates speed,
+ * odometer, and time. Uses filtering and interpolation for smooth speedometer response.
+ * 
+ * The parser runs byte-by-byte in the receive path: RMC/VTG only, checksum
+ * validated incrementally, speed in integer centi-knots, no line buffer.
+ * GPS_PROTOCOL_UBX decodes binary NAV-PVT frames into the same fix fields.
  * 
  * Processing steps:
- * 1. Check if new NMEA sentence received
- * 2. Parse sentence (fails silently if corrupt)
- * 3. Record timestamps for interpolation
- * 4. Convert speed from knots to km/h
+ * 1. Check the fix-ready flag (set only on a valid checksum)
+ * 2. Snapshot speed, fix status, UTC time and arrival timestamp
+ * 3. Record timestamps for interpolation (arrival time from receive ISR)
+ * 4. Convert speed from centi-knots to km/h * 100 (integer)
  * 5. Apply exponential filtering for smooth display
  * 6. Calculate distance traveled since last update
  * 7. Update total and trip odometers
@@ -36,29 +40,48 @@
  * - odo, odoTrip: Odometer values (if SPEED_SOURCE == 0)
  * - hour, minute: GPS time (UTC)
  * 
- * Called from: main loop every 1ms
+ * Called from: main loop when gpsFixReady is set (once per fix, 10 Hz)
  * 
  * Note: Distance calculation uses formula: distance = speed * time * (1 km/h = 2.77778e-7 km/ms)
  */
 void fetchGPSdata();
 
 /**
- * useInterrupt - Enable or disable GPS interrupt-based reading
+ * gpsSpeedNow - GPS speed dead-reckoned to the current time
+ * 
+ * Extrapolates spdGPS from the last fix using the acceleration measured
+ * between the last two fixes (integer math only). Extrapolation stops at
+ * GPS_EXTRAPOLATE_MS after the last fix and the estimate is held there until
+ * the next fix arrives, so a late or dropped fix cannot run the needle away.
+ * The last fix is returned unchanged when either of the two fixes was invalid
+ * (no measured acceleration) or the fix interval exceeds GPS_STALE_MS.
  * 
- * Configures Timer0 to trigger GPS character reading via interrupt.
- * Timer0 is normally used for millis() function - this adds an additional
- * interrupt handler that piggybacks on the existing timer.
+ * @return Estimated speed in km/h * 100 (0 to GPS_SPEED_MAX)
  * 
- * @param v - true to enable interrupts, false to disable
+ * Called from: sensor selection (SPEED_SOURCE 3) and speedometerAngleGPS()
+ */
+unsigned long gpsSpeedNow();
+
+/**
+ * gpsBegin - Initialize GPS UART and receiver configuration
  * 
- * Hardware configuration:
- * - Uses Timer0 Output Compare A (OCR0A)
- * - Triggers at count 0xAF (175 in decimal)
- * - Interrupt fires ~1000 times per second
+ * Configures USART2 directly (Serial2 is not used) with an RX-complete
+ * interrupt that feeds the streaming NMEA parser byte by byte, and sends the
+ * receiver the command to switch from GPS_BAUD_DEFAULT to GPS_BAUD.
  * 
- * Global variables modified:
- * - usingInterrupt: Flag tracking interrupt state
+ * Called from: setup()
+ */
+void gpsBegin();
+
+/**
+ * gpsConfigService - Complete the receiver set-up started by gpsBegin()
+ * 
+ * Once GPS_BAUD_SWITCH_MS has passed since the baud command (no delay()),
+ * moves USART2 to GPS_BAUD and selects RMC-only output, 10 Hz fixes.
+ * With GPS_PROTOCOL_UBX the u-blox receiver is set to UBX-only NAV-PVT output instead.
+ * 
+ * Called from: setup() splash wait and the main loop (returns at once when done)
  */
-void useInterrupt(boolean v);
+void gpsConfigService();
 
 #endif // GPS_H
@@ -8,240 +8,180 @@
 
 ///// IMAGE DATA /////
 // Bitmap images stored in program memory (PROGMEM) for OLED displays
-// Each image is 128x32 pixels (1 bit per pixel = 512 bytes)
-// Generated from graphics using image2cpp or similar tool
+// Source art is 128x32 pixels (1 bit per pixel = 512 bytes) unless noted,
+// generated with image2cpp, then converted to SSD1306 page layout and RLE
+// compressed. Draw with drawImage() (display.cpp), not drawBitmap().
+//
+// Stream format: width, pages, then codes until width*pages bytes are produced
+//   0x00-0x7F  n+1 literal bytes follow
+//   0x80-0xBF  (n & 0x3F)+1 zero bytes (no data byte)
+//   0xC0-0xFF  (n & 0x3F)+2 copies of the next byte
+// Page layout: one byte per column per 8-row page, LSB = top row, pages in order
 
 // 'falcon_script', 128x32px
 // Falcon logo in script font - displayed on startup splash screen
 const unsigned char IMG_FALCON_SCRIPT[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x80, 0x06, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x02, 0x00, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x79, 0x98, 0x60, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf9, 0xf9, 0x31, 0xf3, 0xe3, 0x38, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xe3, 0x87, 0x33, 0x43, 0x27, 0xbf, 0xd8, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x63, 0x86, 0x6e, 0xf3, 0x10, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x08, 0xc3, 0x0c, 0x1c, 0x66, 0x30, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x11, 0x86, 0x38, 0x38, 0xcc, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x13, 0x9e, 0x68, 0x69, 0x88, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1d, 0xe3, 0x8f, 0x8f, 0x18, 0xff, 0xc0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x06, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  128, 4,  // width, pages
+  0x9a, 0xc1, 0x80, 0x01, 0xc0, 0xc0, 0xc1, 0x60, 0xc1, 0x30, 0x00, 0x10, 0xc1, 0x18, 0x00, 0x08,
+  0xc1, 0x0c, 0x01, 0x0e, 0x0e, 0xc1, 0x06, 0x05, 0x0e, 0x0c, 0x0c, 0x18, 0x98, 0xf0, 0x8b, 0x04,
+  0x80, 0xc0, 0x40, 0xc0, 0x80, 0xbf, 0x8f, 0x03, 0x03, 0x03, 0x01, 0x01, 0x88, 0xc3, 0x80, 0xc4,
+  0xc0, 0x06, 0xe0, 0xb0, 0x98, 0x0c, 0x07, 0x81, 0x80, 0xc2, 0xc0, 0x81, 0x0c, 0xc0, 0x60, 0x38,
+  0x8c, 0xc6, 0x63, 0x31, 0x1c, 0x86, 0x83, 0xc0, 0xc0, 0x80, 0x81, 0x04, 0x80, 0x80, 0xc0, 0xc0,
+  0x80, 0x82, 0x01, 0x80, 0x80, 0x81, 0xc1, 0x80, 0xbf, 0x89, 0x09, 0x01, 0x01, 0x81, 0xc1, 0x70,
+  0x38, 0x0c, 0x07, 0x03, 0x01, 0x81, 0x29, 0x38, 0x26, 0x23, 0x11, 0x39, 0x3c, 0x26, 0x23, 0x11,
+  0x10, 0x18, 0x3f, 0x27, 0x22, 0x11, 0x18, 0x08, 0x3c, 0x26, 0x23, 0x21, 0x20, 0x12, 0x1b, 0x0c,
+  0x3e, 0x67, 0x63, 0x31, 0x1b, 0x0e, 0x07, 0x63, 0x39, 0x0d, 0x07, 0x03, 0x31, 0x39, 0x2c, 0x27,
+  0x21, 0xc3, 0x20, 0xbf, 0x82, 0x05, 0xe0, 0xf8, 0x3c, 0x0f, 0x03, 0x01, 0xbf, 0x94
 };
 
 // '302_CID', 128x32px
 // Engine displacement designation: 302 Cubic Inch Displacement
 const unsigned char IMG_302_CID[] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x1f, 0xfe, 0x00, 0xff, 0xfc, 0x03, 0xff, 0xe0, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x7f, 0xff, 0x81, 0xff, 0xfe, 0x0f, 0xff, 0xf8, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0xff, 0xff, 0xc3, 0xff, 0xff, 0x1f, 0xff, 0xfc, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x01, 0xe1, 0xe0, 0x01, 0xff, 0xff, 0xe3, 0xff, 0xff, 0x1f, 0xff, 0xfe, 0x00, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x01, 0xfc, 0x0f, 0xe7, 0xf0, 0x3f, 0x9f, 0x00, 0x7e, 0x00, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x01, 0xf8, 0x07, 0xc7, 0xe0, 0x1f, 0x80, 0x00, 0x7e, 0x00, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x00, 0x00, 0x0f, 0x87, 0xe0, 0x1f, 0x81, 0xff, 0xfe, 0x00, 0x03, 0xc3, 0xc0, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x7f, 0x87, 0xe0, 0x1f, 0x87, 0xff, 0xfc, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x7f, 0xc7, 0xe0, 0x1f, 0x8f, 0xff, 0xf8, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x0f, 0xe7, 0xe0, 0x1f, 0x8f, 0xff, 0xe0, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x01, 0xf8, 0x07, 0xe7, 0xe0, 0x1f, 0x9f, 0xc0, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x01, 0xe1, 0xe0, 0x01, 0xfc, 0x0f, 0xe7, 0xf0, 0x3f, 0x9f, 0x80, 0x00, 0x00, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x01, 0xff, 0xff, 0xe3, 0xff, 0xff, 0x1f, 0xff, 0xfe, 0x00, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x00, 0xff, 0xff, 0xc3, 0xff, 0xff, 0x1f, 0xff, 0xfe, 0x00, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x00, 0x7f, 0xff, 0x81, 0xff, 0xfe, 0x1f, 0xff, 0xfe, 0x00, 0x03, 0xc3, 0xc0, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x1f, 0xfe, 0x00, 0xff, 0xfc, 0x1f, 0xff, 0xfe, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x01, 0xe1, 0xe0, 0x00, 0xe2, 0x4e, 0x23, 0x81, 0x24, 0x71, 0x27, 0x8c, 0x00, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x01, 0x12, 0x49, 0x24, 0x41, 0x34, 0x89, 0x24, 0x10, 0x00, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x01, 0x02, 0x4e, 0x24, 0x01, 0x34, 0x81, 0xe4, 0x0c, 0x00, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x01, 0x02, 0x49, 0x24, 0x01, 0x2c, 0x81, 0x27, 0x82, 0x00, 0x03, 0xc3, 0xc0, 
-	0x1e, 0x1e, 0x1e, 0x01, 0x12, 0x49, 0x24, 0x41, 0x2c, 0x89, 0x24, 0x12, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0xe1, 0x8e, 0x23, 0x81, 0x24, 0x71, 0x27, 0x8c, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  128, 4,  // width, pages
+  0x82, 0xc2, 0x3c, 0xc2, 0xc0, 0xc2, 0x3c, 0xc2, 0xc0, 0xc2, 0x3c, 0x87, 0x03, 0xc0, 0xe0, 0xf0,
+  0xf0, 0xc1, 0xf8, 0xc4, 0x78, 0xc1, 0xf8, 0x03, 0xf0, 0xf0, 0xe0, 0xc0, 0x81, 0x02, 0x80, 0xe0,
+  0xf0, 0xc2, 0xf8, 0xc4, 0x78, 0xc2, 0xf8, 0x02, 0xf0, 0xe0, 0x80, 0x81, 0x04, 0xe0, 0xf0, 0xf0,
+  0xf8, 0xf8, 0xc7, 0x78, 0x05, 0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 0xc0, 0x8a, 0xc2, 0x3c, 0xc2, 0xc0,
+  0xc2, 0x3c, 0xc2, 0xc0, 0xc2, 0x3c, 0x84, 0xc2, 0x3c, 0xc2, 0xc3, 0xc2, 0x3c, 0xc2, 0xc3, 0xc2,
+  0x3c, 0x87, 0xc4, 0xe1, 0x00, 0xc0, 0xc1, 0x80, 0xc1, 0x8c, 0x00, 0xde, 0xc2, 0xff, 0x01, 0xf9,
+  0xf0, 0x81, 0x00, 0x7f, 0xc3, 0xff, 0x00, 0xc0, 0xc4, 0x80, 0x00, 0xc0, 0xc3, 0xff, 0x00, 0x7f,
+  0x81, 0x06, 0xe0, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe, 0xbe, 0xc5, 0x9e, 0x05, 0x9f, 0x9f, 0x8f, 0x8f,
+  0x87, 0x83, 0x8a, 0xc2, 0x3c, 0xc2, 0xc3, 0xc2, 0x3c, 0xc2, 0xc3, 0xc2, 0x3c, 0x84, 0xc2, 0x3c,
+  0xc2, 0xc3, 0xc2, 0x3c, 0xc2, 0xc3, 0xc2, 0x3c, 0x87, 0x13, 0x80, 0x41, 0x43, 0x43, 0x87, 0x07,
+  0x07, 0xc7, 0x07, 0x07, 0xc7, 0x07, 0x07, 0xc7, 0x47, 0x47, 0x83, 0x03, 0x01, 0xc0, 0x81, 0x04,
+  0x80, 0x41, 0x43, 0x47, 0x87, 0xc3, 0x07, 0x16, 0xc7, 0x07, 0x07, 0xc7, 0x87, 0x07, 0xc7, 0x03,
+  0x01, 0x80, 0x40, 0x40, 0x47, 0x87, 0x07, 0x07, 0xc7, 0x07, 0x07, 0xc7, 0x07, 0x07, 0xc7, 0xc1,
+  0x47, 0x05, 0x07, 0x07, 0x87, 0x47, 0x47, 0x07, 0x8a, 0xc2, 0x3c, 0xc2, 0xc3, 0xc2, 0x3c, 0xc2,
+  0xc3, 0xc2, 0x3c, 0x84, 0xc2, 0x3c, 0xc2, 0x03, 0xc2, 0x3c, 0xc2, 0x03, 0xc2, 0x3c, 0x87, 0x00,
+  0x07, 0xc1, 0x08, 0x00, 0x04, 0x81, 0x03, 0x07, 0x08, 0x08, 0x07, 0x81, 0x03, 0x0f, 0x09, 0x09,
+  0x06, 0x81, 0x00, 0x0f, 0x81, 0x00, 0x07, 0xc1, 0x08, 0x00, 0x04, 0x84, 0x00, 0x0f, 0x81, 0x03,
+  0x0f, 0x01, 0x06, 0x0f, 0x81, 0x00, 0x07, 0xc1, 0x08, 0x00, 0x04, 0x81, 0x03, 0x0f, 0x01, 0x01,
+  0x0f, 0x81, 0x00, 0x0f, 0xc1, 0x0a, 0x81, 0x03, 0x04, 0x09, 0x09, 0x06, 0x8a, 0xc2, 0x3c, 0xc2,
+  0x03, 0xc2, 0x3c, 0xc2, 0x03, 0xc2, 0x3c, 0x81
 };
 
 // '2300_turbo', 128x32px
-const unsigned char IMG_2300_TURBO [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x0f, 0xfe, 0x00, 0x7f, 0xf0, 0x07, 0xff, 0x80, 0x7f, 0xf8, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x3f, 0xff, 0x81, 0xff, 0xfc, 0x0f, 0xff, 0xc0, 0xff, 0xfc, 0x3c, 0x3c, 0x3c, 
-	0x01, 0xe1, 0xe0, 0x7f, 0xff, 0xc3, 0xff, 0xfe, 0x1f, 0xff, 0xe1, 0xff, 0xfe, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x7f, 0xff, 0xe7, 0xff, 0xff, 0x1f, 0xff, 0xe1, 0xff, 0xfe, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x7c, 0x07, 0xe7, 0xf0, 0x7f, 0x3f, 0x87, 0xf3, 0xf8, 0x7f, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x00, 0x07, 0xe7, 0xe0, 0x3e, 0x3f, 0x03, 0xf3, 0xf0, 0x3f, 0x03, 0xc3, 0xc0, 
-	0x1e, 0x1e, 0x1e, 0x07, 0xff, 0xe0, 0x00, 0x7c, 0x3f, 0x03, 0xf3, 0xf0, 0x3f, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x1f, 0xff, 0xc0, 0x03, 0xfc, 0x3f, 0x03, 0xf3, 0xf0, 0x3f, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x3f, 0xff, 0x80, 0x03, 0xfe, 0x3f, 0x03, 0xf3, 0xf0, 0x3f, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x3f, 0xfe, 0x00, 0x00, 0x7f, 0x3f, 0x03, 0xf3, 0xf0, 0x3f, 0x3c, 0x3c, 0x3c, 
-	0x01, 0xe1, 0xe0, 0x7f, 0x00, 0x07, 0xe0, 0x3f, 0x3f, 0x03, 0xf3, 0xf0, 0x3f, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x7e, 0x00, 0x07, 0xf0, 0x7f, 0x3f, 0x87, 0xf3, 0xf8, 0x7f, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x7f, 0xff, 0xe7, 0xff, 0xff, 0x1f, 0xff, 0xe1, 0xff, 0xfe, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x7f, 0xff, 0xe3, 0xff, 0xfe, 0x1f, 0xff, 0xe1, 0xff, 0xfe, 0x03, 0xc3, 0xc0, 
-	0x1e, 0x1e, 0x1e, 0x7f, 0xff, 0xe1, 0xff, 0xfc, 0x0f, 0xff, 0xc0, 0xff, 0xfc, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x7f, 0xff, 0xe0, 0x7f, 0xf0, 0x07, 0xff, 0x80, 0x7f, 0xf8, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x01, 0xe1, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x0f, 0xa4, 0xe3, 0x86, 0x1c, 0x48, 0xc7, 0x0e, 0x3c, 0xe0, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x02, 0x24, 0x92, 0x49, 0x22, 0x49, 0x24, 0x91, 0x20, 0x90, 0x03, 0xc3, 0xc0, 
-	0x01, 0xe1, 0xe0, 0x02, 0x24, 0xe3, 0x89, 0x20, 0x79, 0xe7, 0x10, 0x20, 0x90, 0x03, 0xc3, 0xc0, 
-	0x1e, 0x1e, 0x1e, 0x02, 0x24, 0x92, 0x49, 0x20, 0x49, 0x24, 0x93, 0x3c, 0x90, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x02, 0x24, 0x92, 0x49, 0x22, 0x49, 0x24, 0x91, 0x20, 0x90, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x02, 0x18, 0x93, 0x86, 0x1c, 0x49, 0x24, 0x8e, 0x3c, 0xe0, 0x3c, 0x3c, 0x3c, 
-	0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const unsigned char IMG_2300_TURBO[] PROGMEM = {
+  128, 4,  // width, pages
+  0x82, 0xc2, 0x3c, 0xc2, 0xc0, 0xc2, 0x3c, 0xc2, 0xc0, 0xc2, 0x3c, 0x81, 0x02, 0xc0, 0xe0, 0xe0,
+  0xc9, 0xf0, 0x03, 0xe0, 0xe0, 0xc0, 0x80, 0x81, 0x03, 0x80, 0xc0, 0xe0, 0xe0, 0xc9, 0xf0, 0x03,
+  0xe0, 0xe0, 0xc0, 0x80, 0x82, 0x01, 0xc0, 0xe0, 0xca, 0xf0, 0x01, 0xe0, 0xc0, 0x83, 0x01, 0xc0,
+  0xe0, 0xca, 0xf0, 0x01, 0xe0, 0xc0, 0x82, 0xc2, 0x3c, 0xc2, 0xc0, 0xc2, 0x3c, 0xc2, 0xc0, 0xc2,
+  0x3c, 0x84, 0xc2, 0x3c, 0xc2, 0xc3, 0xc2, 0x3c, 0xc2, 0xc3, 0xc2, 0x3c, 0x81, 0x06, 0xc1, 0xf1,
+  0xf9, 0xf9, 0xfd, 0xfc, 0x7c, 0xc3, 0x3c, 0x05, 0x3f, 0x3f, 0x1f, 0x1f, 0x0f, 0x07, 0x81, 0xc4,
+  0xc3, 0x00, 0x81, 0x81, 0xc1, 0x18, 0x00, 0xbd, 0xc2, 0xff, 0x01, 0xf3, 0xe1, 0x81, 0xc4, 0xff,
+  0x00, 0x81, 0x83, 0x00, 0x81, 0xc4, 0xff, 0x81, 0xc4, 0xff, 0x00, 0x81, 0x83, 0x00, 0x81, 0xc4,
+  0xff, 0x81, 0xc2, 0x3c, 0xc2, 0xc3, 0xc2, 0x3c, 0xc2, 0xc3, 0xc2, 0x3c, 0x84, 0xc2, 0x3c, 0xc2,
+  0xc3, 0xc2, 0x3c, 0xc2, 0xc3, 0xc2, 0x3c, 0x81, 0xc1, 0x0f, 0xc3, 0x8f, 0x06, 0x0f, 0x8f, 0x0f,
+  0x0f, 0x8f, 0x0f, 0x0f, 0xc1, 0x8f, 0x81, 0x03, 0x01, 0x83, 0x87, 0x87, 0xc2, 0x0f, 0x01, 0x8f,
+  0x8f, 0xc2, 0x0f, 0x09, 0x8f, 0x87, 0x87, 0x03, 0x01, 0x00, 0x80, 0x00, 0x03, 0x87, 0xc1, 0x0f,
+  0x01, 0x8f, 0x8f, 0xc1, 0x0f, 0xc1, 0x8f, 0x03, 0x0f, 0x07, 0x03, 0x00, 0xc1, 0x80, 0x02, 0x03,
+  0x07, 0x0f, 0xc2, 0x8f, 0x01, 0x0f, 0x0f, 0xc1, 0x8f, 0x03, 0x0f, 0x0f, 0x07, 0x03, 0x82, 0xc2,
+  0x3c, 0xc2, 0xc3, 0xc2, 0x3c, 0xc2, 0xc3, 0xc2, 0x3c, 0x84, 0xc2, 0x3c, 0xc2, 0x03, 0xc2, 0x3c,
+  0xc2, 0x03, 0xc2, 0x3c, 0x86, 0x00, 0x1f, 0x82, 0x03, 0x0f, 0x10, 0x10, 0x0f, 0x81, 0x03, 0x1f,
+  0x02, 0x02, 0x1d, 0x81, 0x03, 0x1f, 0x12, 0x12, 0x0d, 0x81, 0x03, 0x0f, 0x10, 0x10, 0x0f, 0x81,
+  0x00, 0x0f, 0xc1, 0x10, 0x00, 0x09, 0x81, 0x03, 0x1f, 0x02, 0x02, 0x1f, 0x81, 0x03, 0x1f, 0x02,
+  0x02, 0x1f, 0x81, 0x03, 0x1f, 0x02, 0x02, 0x1d, 0x81, 0x04, 0x0f, 0x10, 0x10, 0x14, 0x0d, 0x81,
+  0x00, 0x1f, 0xc1, 0x14, 0x81, 0x03, 0x1f, 0x10, 0x10, 0x0f, 0x85, 0xc2, 0x3c, 0xc2, 0x03, 0xc2,
+  0x3c, 0xc2, 0x03, 0xc2, 0x3c, 0x81
 };
 
 // '302V', 128x32px
 // Alternative engine badge - 302 with V8 symbol
 const unsigned char IMG_302V[] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x0f, 0xfc, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x1f, 0xfe, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x9c, 0x0e, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x98, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x06, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x06, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x98, 0x06, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x9c, 0x0e, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xff, 0xff, 0xf3, 0xff, 0x1f, 0xfe, 0x7f, 0xfb, 0xff, 0xff, 0xc0, 0x00, 0x00, 
-	0x00, 0x00, 0x03, 0xf3, 0xc0, 0x01, 0xfe, 0x0f, 0xfc, 0x7f, 0xf8, 0x01, 0xe7, 0xe0, 0x00, 0x00, 
-	0x00, 0x00, 0x03, 0xfc, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0xe0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0x80, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x3f, 0xf1, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc7, 0xfe, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x0f, 0xfe, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3f, 0xf8, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0xff, 0xc7, 0xc0, 0x00, 0x00, 0x01, 0xf1, 0xff, 0xc0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x7f, 0xf8, 0xfc, 0x00, 0x00, 0x1f, 0x8f, 0xff, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x1f, 0xc0, 0x01, 0xfc, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xe3, 0xfc, 0x1f, 0xe3, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x3f, 0xfe, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x87, 0xf0, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xe1, 0xc3, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  128, 4,  // width, pages
+  0xac, 0x02, 0x30, 0x38, 0x1c, 0xc1, 0x0c, 0xc1, 0xcc, 0x02, 0xfc, 0xf8, 0x30, 0x81, 0x02, 0xf8,
+  0xfc, 0x1c, 0xc4, 0x0c, 0x02, 0x1c, 0xfc, 0xf8, 0x81, 0x01, 0x18, 0x9c, 0xc6, 0xcc, 0x01, 0xfc,
+  0x78, 0xbf, 0x80, 0x07, 0x18, 0x1c, 0x3c, 0x3c, 0x7c, 0x7c, 0xf4, 0xf4, 0xc1, 0xec, 0x0e, 0xdc,
+  0xd4, 0xd4, 0xb4, 0xa4, 0xa4, 0x64, 0x44, 0x44, 0xc4, 0x84, 0x80, 0x83, 0x87, 0x0e, 0xc4, 0x0c,
+  0x02, 0x0f, 0x07, 0x03, 0x81, 0x02, 0x07, 0x0f, 0x0e, 0xc4, 0x0c, 0x02, 0x0e, 0x0f, 0x07, 0x81,
+  0x02, 0x0f, 0x0f, 0x0d, 0xc4, 0x0c, 0xc1, 0x8c, 0x0a, 0x80, 0xc4, 0x44, 0x44, 0x64, 0xa4, 0xa4,
+  0xb4, 0xd4, 0xd4, 0xdc, 0xc1, 0xec, 0x07, 0xf4, 0xf4, 0x7c, 0x7c, 0x3c, 0x3c, 0x1c, 0x18, 0xb3,
+  0x01, 0x01, 0x01, 0xc1, 0x03, 0x01, 0x07, 0x07, 0xc1, 0x0f, 0x09, 0x1f, 0x1e, 0x3e, 0x3e, 0x3d,
+  0x7d, 0x7d, 0xfb, 0xfb, 0xfa, 0xc1, 0xf6, 0xc1, 0xec, 0x05, 0xcc, 0xd8, 0x98, 0x98, 0x38, 0x30,
+  0xc1, 0x70, 0x05, 0x30, 0x38, 0x98, 0x98, 0xd8, 0xcc, 0xc1, 0xec, 0xc1, 0xf6, 0x09, 0xfa, 0xfb,
+  0xfb, 0x7d, 0x7d, 0x3d, 0x3e, 0x3e, 0x1e, 0x1f, 0xc1, 0x0f, 0x01, 0x07, 0x07, 0xc1, 0x03, 0x01,
+  0x01, 0x01, 0xbf, 0x90, 0x0b, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0f, 0x0f, 0x1f, 0x1f, 0x3f,
+  0x3f, 0xc1, 0x7e, 0x0b, 0x3f, 0x3f, 0x1f, 0x1f, 0x0f, 0x0f, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01,
+  0xb1
 };
 
 // 'Oil Pressure Icon', 40x32px
 // Icon showing oil can symbol - displayed alongside oil pressure reading
 const unsigned char IMG_OIL_PRS[] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0xe0, 
-	0x00, 0x00, 0x3f, 0xcf, 0xe0, 0x00, 0x38, 0x33, 0xe3, 0x80, 0x01, 0xfc, 0x30, 0xff, 0xf8, 0x1f, 
-	0xf8, 0x38, 0x7f, 0xfc, 0xff, 0x80, 0x1e, 0x7f, 0xff, 0xff, 0x00, 0x07, 0xe0, 0x07, 0x8e, 0x08, 
-	0x01, 0xe0, 0x00, 0x1e, 0x08, 0x00, 0x60, 0x00, 0x1c, 0x1c, 0x00, 0x60, 0x00, 0x38, 0x1c, 0x00, 
-	0x60, 0x00, 0x70, 0x1c, 0x00, 0x7f, 0xff, 0xe0, 0x08, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x7f, 
-	0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  40, 4,  // width, pages
+  0xa9, 0x0b, 0x3c, 0x7e, 0x66, 0xc6, 0xce, 0x8c, 0x9c, 0xfc, 0xf8, 0x70, 0x76, 0x76, 0xc1, 0x7e,
+  0x0a, 0x76, 0x76, 0x70, 0x70, 0xe0, 0xc0, 0xc0, 0xe0, 0x60, 0x60, 0x70, 0xc1, 0xf0, 0x06, 0x78,
+  0x38, 0x18, 0x1c, 0x1c, 0x9c, 0x08, 0x88, 0x03, 0x01, 0x01, 0x7f, 0x7f, 0xcc, 0x70, 0x05, 0x38,
+  0x1c, 0x0f, 0x07, 0x03, 0x01, 0x83, 0x02, 0x0e, 0x1f, 0x0e, 0xa9
 };
 
 // 'Oil Temp Icon', 40x32px
 // Icon combining oil can and thermometer - for oil temperature display
 const unsigned char IMG_OIL_TEMP[] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xc0, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x01, 
-	0xff, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x1e, 0x01, 0xe0, 
-	0x00, 0x00, 0x3f, 0xc1, 0xe0, 0x00, 0x38, 0x33, 0xe1, 0xff, 0x01, 0xfc, 0x30, 0xf9, 0xff, 0x1f, 
-	0xf8, 0x38, 0x79, 0xe0, 0x3f, 0x80, 0x1e, 0x79, 0xe0, 0x3f, 0x00, 0x07, 0xe1, 0xe0, 0x0e, 0x08, 
-	0x01, 0xe1, 0xff, 0x1e, 0x08, 0x00, 0x61, 0xff, 0x1c, 0x1c, 0x00, 0x61, 0xe0, 0x38, 0x1c, 0x00, 
-	0x61, 0xe0, 0x70, 0x1c, 0x00, 0x73, 0xf3, 0xe0, 0x08, 0x00, 0x73, 0xf3, 0xc0, 0x00, 0x00, 0x73, 
-	0xf3, 0x80, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  40, 4,  // width, pages
+  0x8e, 0x03, 0xf0, 0xf8, 0xf8, 0xf0, 0xc3, 0xc0, 0x91, 0x0a, 0x3c, 0x7e, 0x66, 0xc6, 0xce, 0x8c,
+  0x9c, 0xfc, 0xf8, 0x70, 0x70, 0x81, 0xc2, 0xff, 0xc3, 0x18, 0x81, 0x01, 0x60, 0x70, 0xc1, 0xf0,
+  0x06, 0x78, 0x38, 0x18, 0x1c, 0x1c, 0x9c, 0x08, 0x88, 0x04, 0x01, 0x01, 0x7f, 0x7f, 0x70, 0x81,
+  0x00, 0xf0, 0xc2, 0xff, 0x0b, 0xf3, 0x03, 0x03, 0x73, 0x73, 0x70, 0x38, 0x1c, 0x0f, 0x07, 0x03,
+  0x01, 0x83, 0x02, 0x0e, 0x1f, 0x0e, 0x90, 0xc2, 0x01, 0x94
 };
 
-// 'Battery Icon', 38x32px
+// 'Battery Icon', 35x32px
 // Battery symbol with + and - terminals - for voltage display
 const unsigned char IMG_BATT_VOLT[] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0x00, 0x78, 
-	0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 
-	0xff, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0xc0, 0x0c, 0x00, 0x00, 0x30, 
-	0xc0, 0x0c, 0x00, 0x00, 0x30, 0xc0, 0x0c, 0xfc, 0x00, 0xfc, 0xc0, 0x0c, 0xfc, 0x00, 0xfc, 0xc0, 
-	0x0c, 0x00, 0x00, 0x30, 0xc0, 0x0c, 0x00, 0x00, 0x30, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0xc0, 0x0c, 
-	0x00, 0x00, 0x00, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0xc0, 0x0c, 0x00, 
-	0x00, 0x00, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  35, 4,  // width, pages
+  0x88, 0xc2, 0xe0, 0x8b, 0xc2, 0xe0, 0x89, 0x03, 0xff, 0xff, 0x03, 0x03, 0xc4, 0xc3, 0xc8, 0x03,
+  0x09, 0xc3, 0xc3, 0xf3, 0xf3, 0xc3, 0xc3, 0x03, 0x03, 0xff, 0xff, 0x84, 0x01, 0xff, 0xff, 0xd2,
+  0x80, 0x01, 0x83, 0x83, 0xc2, 0x80, 0x01, 0xff, 0xff, 0x84, 0xdc, 0x01, 0x80
 };
 
-// 'Eng Temp Icon', 35x32px
+// 'Eng Temp Icon', 38x32px
 // Thermometer icon for coolant/engine temperature display
 const unsigned char IMG_COOLANT_TEMP[] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0x80, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf0, 
-	0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0xff, 0x80, 
-	0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 
-	0x00, 0xf0, 0x00, 0x00, 0x07, 0x81, 0xf8, 0x3c, 0x00, 0x1f, 0xf9, 0xf9, 0xff, 0x00, 0x18, 0x79, 
-	0xf9, 0xc3, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  38, 4,  // width, pages
+  0x8f, 0x03, 0xf0, 0xf8, 0xf8, 0xf0, 0xc3, 0xc0, 0x9c, 0xc2, 0xff, 0xc3, 0x18, 0x8f, 0x01, 0x60,
+  0x60, 0xc2, 0x30, 0xc2, 0x60, 0x81, 0x00, 0xf0, 0xc2, 0xff, 0x05, 0xf3, 0x03, 0x03, 0x63, 0x63,
+  0x60, 0xc2, 0x30, 0x01, 0x60, 0x60, 0x89, 0x00, 0x04, 0xc1, 0x0c, 0xc2, 0x18, 0xc2, 0x0c, 0xc2,
+  0x19, 0xc2, 0x0c, 0xc2, 0x18, 0xc1, 0x0c, 0x00, 0x04, 0x85
 };
 
 // 'Gas Icon', 32x32px
 // Gas pump icon for fuel level display
 const unsigned char IMG_FUEL_LVL[] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xe6, 0x00, 
-	0x07, 0xff, 0xf7, 0x80, 0x07, 0xff, 0xf3, 0xc0, 0x07, 0x00, 0x71, 0xe0, 0x07, 0x00, 0x70, 0xe0, 
-	0x07, 0x00, 0x70, 0xf0, 0x07, 0x00, 0x70, 0x70, 0x07, 0x00, 0x70, 0x78, 0x07, 0x00, 0x70, 0x70, 
-	0x07, 0xff, 0xf0, 0x60, 0x07, 0xff, 0xfc, 0x60, 0x07, 0xff, 0xfe, 0x30, 0x07, 0xff, 0xf6, 0x30, 
-	0x07, 0xff, 0xf6, 0x30, 0x07, 0xff, 0xf6, 0x30, 0x07, 0xff, 0xf6, 0x30, 0x07, 0xff, 0xf6, 0x38, 
-	0x07, 0xff, 0xf6, 0x18, 0x07, 0xff, 0xf6, 0x18, 0x07, 0xff, 0xf6, 0x18, 0x07, 0xff, 0xf6, 0x18, 
-	0x07, 0xff, 0xf7, 0xb8, 0x07, 0xff, 0xf3, 0xf0, 0x07, 0xff, 0xf0, 0xc0, 0x0f, 0xff, 0xf8, 0x00, 
-	0x0f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  32, 4,  // width, pages
+  0x84, 0x02, 0xf0, 0xf8, 0xf8, 0xc7, 0x38, 0x09, 0xf8, 0xf8, 0xf0, 0x00, 0x18, 0x38, 0x70, 0xf0,
+  0xe0, 0xc0, 0x89, 0xc1, 0xff, 0xc7, 0xf0, 0xc1, 0xff, 0x08, 0x60, 0xe0, 0xc0, 0x00, 0x01, 0x3f,
+  0xff, 0xcf, 0x04, 0x87, 0xcd, 0xff, 0x80, 0x01, 0xff, 0xff, 0x82, 0x02, 0x0f, 0xff, 0xf8, 0x86,
+  0x00, 0x18, 0xcd, 0x1f, 0x08, 0x18, 0x01, 0x03, 0x03, 0x07, 0x06, 0x03, 0x03, 0x01, 0x82
 };
 
 // 'turbo_icon', 24x30px
-// Turbocharger icon for boost display.
-const unsigned char IMG_TURBO [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x0e, 0x01, 0xff, 0xfa, 0x07, 0x3f, 0xfa, 0x0d, 0xff, 0xfa, 0x1b, 0xff, 0xfa, 0x36, 0x27, 
-	0xfa, 0x2c, 0x63, 0xfe, 0x7b, 0x4d, 0x8e, 0x79, 0xf9, 0xc0, 0x78, 0x91, 0xc0, 0x79, 0xf9, 0xc0, 
-	0x7e, 0x27, 0xc0, 0x3c, 0x63, 0xc0, 0x3f, 0x4f, 0x80, 0x1f, 0xff, 0x80, 0x0f, 0xff, 0x00, 0x07, 
-	0xfe, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+// Turbocharger icon for boost display. Stored 4 rows down (24x32) so it lands page-aligned.
+const unsigned char IMG_TURBO[] PROGMEM = {
+  24, 4,  // width, pages
+  0x99, 0x0b, 0xc0, 0x60, 0xb0, 0xd8, 0x68, 0x3c, 0x34, 0xb4, 0xfc, 0x3c, 0x3c, 0x7c, 0xc4, 0xfc,
+  0x02, 0xfe, 0x82, 0xfe, 0x81, 0x10, 0x1f, 0x7f, 0xff, 0xff, 0xf0, 0xd1, 0xcb, 0x8e, 0xeb, 0xba,
+  0x8e, 0xcb, 0xd1, 0xf0, 0xff, 0xff, 0x3e, 0x81, 0xc1, 0x01, 0x84, 0x02, 0x01, 0x03, 0x03, 0xc4,
+  0x07, 0x02, 0x03, 0x03, 0x01, 0x87
 };
 
-
-
+// Large numeric font: classic 5x7 GFX glyphs pre-scaled x3 (15x24px in an 18px cell)
+// SSD1306 page layout: 15 columns x 3 pages per glyph, column-major, LSB = top row
+// Glyph order matches FONT_DIGITS_X3_CHARS in display.cpp: 0-9 . - : %
+const unsigned char FONT_DIGITS_X3[] PROGMEM = {
+  0xf8, 0xff, 0x03, 0xf8, 0xff, 0x03, 0xf8, 0xff, 0x03, 0x07, 0x70, 0x1c, 0x07, 0x70, 0x1c, 0x07, 0x70, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0xc7, 0x01, 0x1c, 0xc7, 0x01, 0x1c, 0xc7, 0x01, 0x1c, 0xf8, 0xff, 0x03, 0xf8, 0xff, 0x03, 0xf8, 0xff, 0x03,  // '0'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '1'
+  0x38, 0xf0, 0x1f, 0x38, 0xf0, 0x1f, 0x38, 0xf0, 0x1f, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0xf8, 0x01, 0x1c, 0xf8, 0x01, 0x1c, 0xf8, 0x01, 0x1c,  // '2'
+  0x07, 0x80, 0x03, 0x07, 0x80, 0x03, 0x07, 0x80, 0x03, 0x07, 0x00, 0x1c, 0x07, 0x00, 0x1c, 0x07, 0x00, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0xc7, 0x0f, 0x1c, 0xc7, 0x0f, 0x1c, 0xc7, 0x0f, 0x1c, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03, 0x3f, 0xf0, 0x03,  // '3'
+  0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0xc0, 0x71, 0x00, 0xc0, 0x71, 0x00, 0xc0, 0x71, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x1f, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,  // '4'
+  0xff, 0x81, 0x03, 0xff, 0x81, 0x03, 0xff, 0x81, 0x03, 0xc7, 0x01, 0x1c, 0xc7, 0x01, 0x1c, 0xc7, 0x01, 0x1c, 0xc7, 0x01, 0x1c, 0xc7, 0x01, 0x1c, 0xc7, 0x01, 0x1c, 0xc7, 0x01, 0x1c, 0xc7, 0x01, 0x1c, 0xc7, 0x01, 0x1c, 0x07, 0xfe, 0x03, 0x07, 0xfe, 0x03, 0x07, 0xfe, 0x03,  // '5'
+  0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x03, 0x38, 0x0e, 0x1c, 0x38, 0x0e, 0x1c, 0x38, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0xf0, 0x03, 0x07, 0xf0, 0x03, 0x07, 0xf0, 0x03,  // '6'
+  0x07, 0x00, 0x1c, 0x07, 0x00, 0x1c, 0x07, 0x00, 0x1c, 0x07, 0x80, 0x03, 0x07, 0x80, 0x03, 0x07, 0x80, 0x03, 0x07, 0x70, 0x00, 0x07, 0x70, 0x00, 0x07, 0x70, 0x00, 0x07, 0x0e, 0x00, 0x07, 0x0e, 0x00, 0x07, 0x0e, 0x00, 0xff, 0x01, 0x00, 0xff, 0x01, 0x00, 0xff, 0x01, 0x00,  // '7'
+  0xf8, 0xf1, 0x03, 0xf8, 0xf1, 0x03, 0xf8, 0xf1, 0x03, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0xf8, 0xf1, 0x03, 0xf8, 0xf1, 0x03, 0xf8, 0xf1, 0x03,  // '8'
+  0xf8, 0x01, 0x1c, 0xf8, 0x01, 0x1c, 0xf8, 0x01, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x0e, 0x1c, 0x07, 0x8e, 0x03, 0x07, 0x8e, 0x03, 0x07, 0x8e, 0x03, 0xf8, 0x7f, 0x00, 0xf8, 0x7f, 0x00, 0xf8, 0x7f, 0x00,  // '9'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1f, 0x00, 0x80, 0x1f, 0x00, 0x80, 0x1f, 0x00, 0x80, 0x1f, 0x00, 0x80, 0x1f, 0x00, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '.'
+  0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00,  // '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf1, 0x03, 0xf8, 0xf1, 0x03, 0xf8, 0xf1, 0x03, 0xf8, 0xf1, 0x03, 0xf8, 0xf1, 0x03, 0xf8, 0xf1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ':'
+  0x3f, 0x80, 0x03, 0x3f, 0x80, 0x03, 0x3f, 0x80, 0x03, 0x3f, 0x70, 0x00, 0x3f, 0x70, 0x00, 0x3f, 0x70, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0xc0, 0x81, 0x1f, 0xc0, 0x81, 0x1f, 0xc0, 0x81, 0x1f, 0x38, 0x80, 0x1f, 0x38, 0x80, 0x1f, 0x38, 0x80, 0x1f,  // '%'
+};
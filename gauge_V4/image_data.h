@@ -4,8 +4,8 @@
  * ========================================
  * 
  * Bitmap images stored in program memory (PROGMEM) for OLED displays
- * Each image is 128x32 pixels (1 bit per pixel = 512 bytes) unless otherwise noted
- * Generated from graphics using image2cpp or similar tool
+ * Images are RLE compressed in SSD1306 page layout (format in image_data.cpp)
+ * and drawn with drawImage(); sizes below are the decoded dimensions
  */
 
 #ifndef IMAGE_DATA_H
@@ -22,9 +22,12 @@ extern const unsigned char IMG_2300_TURBO[] PROGMEM;     // 128x32px - 2300 turb
 // Sensor icons for displays
 extern const unsigned char IMG_OIL_PRS[] PROGMEM;        // 40x32px - Oil can icon
 extern const unsigned char IMG_OIL_TEMP[] PROGMEM;       // 40x32px - Oil can with thermometer
-extern const unsigned char IMG_BATT_VOLT[] PROGMEM;      // 38x32px - Battery icon
-extern const unsigned char IMG_COOLANT_TEMP[] PROGMEM;   // 35x32px - Thermometer icon
+extern const unsigned char IMG_BATT_VOLT[] PROGMEM;      // 35x32px - Battery icon
+extern const unsigned char IMG_COOLANT_TEMP[] PROGMEM;   // 38x32px - Thermometer icon
 extern const unsigned char IMG_FUEL_LVL[] PROGMEM;       // 32x32px - Gas pump icon
-extern const unsigned char IMG_TURBO[] PROGMEM;          // 24x30px - Turbo icon
+extern const unsigned char IMG_TURBO[] PROGMEM;          // 24x32px - Turbo icon (30px art, 4 rows down)
+
+// Fonts
+extern const unsigned char FONT_DIGITS_X3[] PROGMEM;     // 15x24px glyphs, SSD1306 page layout (45 bytes each)
 
 #endif // IMAGE_DATA_H
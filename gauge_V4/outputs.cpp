@@ -6,6 +6,7 @@
 
 #include "outputs.h"
 #include "globals.h"
+#include "gps.h"
 
 // ===== CONVERSION CONSTANTS =====
 const float KM_TO_MILES = 0.621371;  // Conversion factor: kilometers to miles
@@ -190,31 +191,22 @@ void ledShiftLight(int ledRPM){
 
   FastLED.show();
 }
-int speedometerAngle(int sweep) {
-  unsigned long t_curr =  millis()-lagGPS;  // Current time minus GPS lag
-  // Interpolate speed between last two GPS readings for smooth motion
-  float spd_g_float = map(t_curr, t_old, t_new, v_old, spdGPS)*0.6213712;   // Convert km/h*100 to mph*100
-  spd_g = (unsigned long)spd_g_float;
-  
-  if (spd_g < 50) spd_g = 0;         // Dead zone: below 0.5 mph, show zero
-  if (spd_g > SPEEDO_MAX) spd_g = SPEEDO_MAX;  // Clamp to max (100 mph * 100 = 10000)
-  
-  int angle = map( spd_g, 0, SPEEDO_MAX, 1, sweep-1);  // Map speed to motor angle
-  
-  
-  angle = constrain(angle, 1, sweep-1);  // Ensure angle is within valid range
+// Convert km/h*100 to a needle angle (integer math, same scaling as speedometerAngleS)
+static int gpsSpeedAngle(unsigned long kmh100, int sweep) {
+  if (kmh100 > 30000) kmh100 = 30000;                        // 300 km/h * 100, well above typical max speed
+  spd_g = (unsigned int)((kmh100 * 62137UL) / 100000UL);     // km/h*100 -> mph*100
+  if (spd_g < 50) spd_g = 0;                                  // if speed is below 0.5 mph set to zero
+  if (spd_g > SPEEDO_MAX) spd_g = SPEEDO_MAX;                 // set max pointer rotation
+
+  int angle = ((long)spd_g * (long)(sweep - 2)) / (long)SPEEDO_MAX + 1;  // calculate angle of gauge
+  angle = constrain(angle, 1, sweep-1);
   return angle;
 }
+int speedometerAngle(int sweep) {
+  return gpsSpeedAngle(gpsSpeedNow(), sweep);  // GPS speed extrapolated from the last fix
+}
 int speedometerAngleGPS(int sweep) {
-  unsigned long t_curr =  millis()-lagGPS;
-  float spd_g_float = map(t_curr, t_old, t_new, v_old, spdGPS)*0.6213712;   // interpolate values between GPS data fix, convert from km/h x100 to mph x100
-  spd_g = (unsigned long)spd_g_float;
-  if (spd_g < 50) spd_g = 0;                                  // if speed is below 0.5 mph set to zero
-  if (spd_g > SPEEDO_MAX) spd_g = SPEEDO_MAX;                   // set max pointer rotation
-  
-  int angle = map( spd_g, 0, SPEEDO_MAX, 1, sweep-1);         // calculate angle of gauge 
-  angle = constrain(angle, 1, sweep-1);
-  return angle;                                               // return angle of motor
+  return gpsSpeedAngle(gpsSpeedNow(), sweep);
 }
 int speedometerAngleCAN(int sweep) {
   int angle = map( spdCAN, 0, SPEEDO_MAX, 1, sweep-1);         // calculate angle of gauge 
@@ -12,8 +12,8 @@
 #include <Arduino.h>
 
 // Stepper motor angle calculation functions
-int speedometerAngle(int sweep);              // GPS speed to speedometer angle
-int speedometerAngleGPS(int sweep);           // GPS speed (original version)
+int speedometerAngle(int sweep);              // GPS speed (dead-reckoned) to speedometer angle
+int speedometerAngleGPS(int sweep);           // GPS speed (dead-reckoned, integer math)
 int speedometerAngleCAN(int sweep);           // CAN speed to angle
 int speedometerAngleHall(int sweep);          // Hall sensor speed to angle
 int speedometerAngleS(int sweep);             // Generic speed to angle for motorS (integer math)
@@ -8,6 +8,8 @@
 #include "globals.h"
 #include "outputs.h"
 #include "utilities.h"
+#include "gps.h"
+#include "timebase.h"
 
 // ===== VR-SAFE COMBINED FILTER STATE =====
 // State machine for startup filtering (VR-safe, Hall-compatible)
@@ -28,6 +30,15 @@ static SpeedSensorState sensorState = STANDSTILL;
 static unsigned long lastFilteredInterval = 0;
 static unsigned long lastPulseArrivalTime = 0;  // Track when last pulse was added to buffer
 
+// Pulse-counting mode (high pulse rates): ISR only counts edges and stamps the
+// last one; hallSpeedUpdate() derives the mean interval over each 20ms gate.
+// Timestamps are micros(), or Timer5 ticks when HALL_INPUT_CAPTURE is enabled.
+static volatile bool hallCountMode = false;
+static volatile uint16_t hallCountEdges = 0;        // Edges since last gate
+static volatile unsigned long hallCountLastEdge = 0; // Timestamp of most recent edge
+static unsigned long hallGateLastEdge = 0;           // Last edge of previous gate
+static unsigned long hallLastCapture = 0;            // Last accepted Hall capture (ticks)
+
 // Previous speed for acceleration limiting
 static unsigned int spdHallPrev = 0;
 static unsigned long lastSpeedUpdateTime = 0;
@@ -41,6 +52,45 @@ static unsigned long lastSyntheticOdometerUpdateTime = 0;
 // Serial speed odometer update tracking
 static unsigned long lastSerialOdometerUpdateTime = 0;
 
+// ===== SPEED FUSION STATE =====
+static uint8_t fusionSource = 0;                // Active source (SPEED_SOURCE numbering, 0 = none)
+static int fusionOutput = 0;                    // Last fused speed (km/h * 100)
+static int fusionOffset = 0;                    // Bumpless-transfer offset after a source switch
+static unsigned long fusionHallOkTime = 0;      // millis() when Hall was last plausible
+static unsigned long fusionLastGPSTime = 0;     // t_new of the last GPS fix seen
+static unsigned long fusionPrevGPS = 0;         // Previous GPS speed for steady-cruise check
+static unsigned long lastFusedOdometerUpdateTime = 0;
+
+// ===== IGNITION INTERVAL QUEUE =====
+// ISR only timestamps and enqueues; engineRPMUpdate() does the math.
+// Size must be a power of 2 (head/tail are free-running uint8_t).
+// NOTE: 16 slots per 20ms update = 800 Hz (12k RPM on a V8); overruns drop oldest.
+#define IGN_INTERVAL_BUFFER_SIZE 16
+#define IGN_INTERVAL_BUFFER_MASK (IGN_INTERVAL_BUFFER_SIZE - 1)
+static volatile unsigned long ignIntervalBuffer[IGN_INTERVAL_BUFFER_SIZE] = {0};
+static volatile uint8_t ignIntervalHead = 0;  // Written by ISR only
+static uint8_t ignIntervalTail = 0;           // Written by main loop only
+
+// One-engine-cycle sliding window (CYL_COUNT intervals) for cycle averaging
+// NOTE: 64 bytes SRAM; sized for the CYL_COUNT maximum of 16
+#define IGN_CYCLE_WINDOW_MAX 16
+static unsigned long ignCycleWindow[IGN_CYCLE_WINDOW_MAX] = {0};
+static unsigned long ignCycleSum = 0;
+static uint8_t ignCycleIndex = 0;
+static uint8_t ignCycleCount = 0;
+static uint8_t ignCycleLen = 0;
+
+// ===== TRIGGER WHEEL STATE =====
+// Per-tooth ISR state; a completed revolution period is pushed to the ignition queue
+static unsigned long toothIntervalPrev = 0;  // Previous tooth interval (μs)
+static unsigned long wheelRevAccum = 0;      // Sum of tooth intervals since last gap (μs)
+static uint8_t wheelToothCount = 0;          // Tooth edges since last gap
+
+// Shared ISR-side interval handlers (micros() path and input capture path)
+static bool hallProcessInterval(unsigned long pulseInterval, unsigned long currentTime);
+static bool ignitionProcessInterval(unsigned long pulseInterval);
+static void triggerWheelProcessTooth(unsigned long toothInterval);
+
 // VR-Safe filter constants
 #define LOW_SPEED_THRESHOLD_FOR_VR_REJECTION 1000  // 10 km/h in units of km/h*100
 #define MAX_ACCELERATION_UNITS 3530UL  // 1g acceleration ≈ 35.3 km/h/s ≈ 3530 (km/h*100)/s
@@ -145,12 +195,13 @@ static bool checkIntervalCoherence() {
  * hallSpeedISR - Hall effect speed sensor interrupt handler
  * 
  * ISR Design: Lightweight and deterministic
- * - Captures pulse timestamp using micros()
+ * - Captures pulse timestamp using micros() (TIMER5_CAPT_vect when HALL_INPUT_CAPTURE)
  * - Performs basic sanity checks on pulse interval
  * - Enqueues interval into ring buffer for median filtering
  * - All heavy processing deferred to hallSpeedUpdate() in main loop
  * 
- * Performance: ~8-15 µs execution time (mostly conditional checks)
+ * Performance: ~8-15 µs execution time (mostly conditional checks),
+ * ~4 µs in pulse-counting mode (count + timestamp only)
  * 
  * VR-Safe Combined Filter Implementation:
  * - Timestamps pulses and enqueues intervals into ring buffer
@@ -166,20 +217,37 @@ static bool checkIntervalCoherence() {
  */
 void hallSpeedISR() {
     unsigned long currentTime = micros();
-    unsigned long pulseInterval = currentTime - hallLastTime;
-    
+    if (hallCountMode) {
+        hallCountLastEdge = currentTime;
+        hallCountEdges++;
+        return;
+    }
+    if (hallProcessInterval(currentTime - hallLastTime, currentTime)) {
+        hallLastTime = currentTime;
+    }
+}
+
+/**
+ * hallProcessInterval - Validate and enqueue one Hall pulse interval (ISR context)
+ * @param pulseInterval - Time since last baseline pulse (μs)
+ * @param currentTime - micros() at this pulse, used for timeout tracking
+ * @return true if this pulse becomes the new interval baseline
+ * 
+ * Shared by hallSpeedISR() (micros() timestamps) and the Timer5 input capture ISR.
+ */
+static bool hallProcessInterval(unsigned long pulseInterval, unsigned long currentTime) {
     // Basic interval sanity checks
     // Minimum: 100 μs (filters electrical noise, allows up to ~500 km/h)
     // Maximum: MAX_VALID_PULSE_INTERVAL (filters stale intervals from standstill)
     if (pulseInterval <= 100 || pulseInterval >= MAX_VALID_PULSE_INTERVAL) {
         // Very long interval = standstill detected
         if (pulseInterval >= MAX_VALID_PULSE_INTERVAL) {
-            hallLastTime = currentTime;
             sensorState = STANDSTILL;
             intervalBufferCount = 0;
             intervalBufferIndex = 0;
+            return true;
         }
-        return;
+        return false;
     }
     
     // VR-Safe: Low-speed robustness check
@@ -190,12 +258,11 @@ void hallSpeedISR() {
         // Integer math: interval * 5 < lastFilteredInterval * 2
         if ((pulseInterval * 5) < (lastFilteredInterval * 2)) {
             // Reject this interval - likely a VR misfire
-            return;
+            return false;
         }
     }
     
-    // Accept interval - update timestamp and add to ring buffer
-    hallLastTime = currentTime;
+    // Accept interval - caller updates its timestamp baseline
     lastPulseArrivalTime = currentTime;  // Track when pulse was added to buffer
     
     // Add interval to ring buffer (median filter)
@@ -207,6 +274,7 @@ void hallSpeedISR() {
     
     // State machine transitions handled in hallSpeedUpdate()
     // ISR only timestamps and enqueues - keeps it fast and deterministic
+    return true;
 }
 
 
@@ -217,12 +285,55 @@ void hallSpeedISR() {
  * - Median filter on pulse intervals
  * - Acceleration limiting (1g max)
  * - Speed decay when pulses slow down
+ * - Pulse-counting mode above HALL_COUNT_ENTER_INTERVAL pulse rate
  * 
  * Called every 20ms from main loop
  */
 void hallSpeedUpdate() {
     static unsigned long lastUpdateTime = 0;
     unsigned long currentTime = micros();
+
+    // ===== PULSE-COUNTING GATE =====
+    // At high pulse rates the mean interval over the gate replaces the median,
+    // so per-pulse ISR work stays minimal whatever teeth × speed is.
+    unsigned long gateInterval = 0;
+    if (hallCountMode) {
+        noInterrupts();
+        uint16_t edges = hallCountEdges;
+        hallCountEdges = 0;
+        unsigned long lastEdge = hallCountLastEdge;
+        interrupts();
+
+        if (edges > 0) {
+            unsigned long span = lastEdge - hallGateLastEdge;
+            if (HALL_INPUT_CAPTURE) {
+                span = (span + 1) >> 1;  // 0.5 µs ticks -> µs
+            }
+            hallGateLastEdge = lastEdge;
+            gateInterval = (span + (edges >> 1)) / edges;
+            hallLastTime = currentTime;  // ISR does not touch it in counting mode
+            lastPulseArrivalTime = currentTime;
+        }
+
+        // Drop back to per-interval mode: seed the median buffer and hand the
+        // ISR the last edge as its baseline so the next interval is exact
+        if (gateInterval > HALL_COUNT_EXIT_INTERVAL) {
+            for (uint8_t i = 0; i < INTERVAL_BUFFER_SIZE; i++) {
+                intervalBuffer[i] = gateInterval;
+            }
+            intervalBufferIndex = 0;
+            intervalBufferCount = INTERVAL_BUFFER_SIZE;
+            noInterrupts();
+            if (HALL_INPUT_CAPTURE) {
+                hallLastCapture = lastEdge;
+            } else {
+                hallLastTime = lastEdge;
+            }
+            hallCountMode = false;
+            interrupts();
+        }
+    }
+
     unsigned long timeSinceLastPulse = currentTime - hallLastTime;
     
     // ===== TIMEOUT HANDLING =====
@@ -237,6 +348,7 @@ void hallSpeedUpdate() {
         lastFilteredInterval = 0;
         lastSpeedUpdateTime = currentTime;
         lastPulseArrivalTime = 0;  // Reset pulse arrival tracking
+        hallCountMode = false;
         
         // Update odometer (with speed = 0)
         if (SPEED_SOURCE == 2 && lastUpdateTime != 0) {
@@ -286,18 +398,31 @@ void hallSpeedUpdate() {
     bool hasRecentPulse = (timeSinceLastPulseArrival < SPEED_DECAY_THRESHOLD);
     
     if (sensorState == MOVING && intervalBufferCount > 0 && hasRecentPulse) {
-        // Get median interval from buffer (VR-safe: rejects outliers)
-        unsigned long medianInterval = getMedianInterval();
-        lastFilteredInterval = medianInterval;
+        // Get median interval from buffer (VR-safe: rejects outliers),
+        // or the gate mean in counting mode (0 = no edges this gate)
+        unsigned long medianInterval = hallCountMode ? gateInterval
+                                     : (gateInterval > 0 ? gateInterval : getMedianInterval());
         
         if (medianInterval > 0) {
+            lastFilteredInterval = medianInterval;
+
+            // Switch to pulse counting at high rates; baseline is the last accepted edge
+            if (!hallCountMode && medianInterval < HALL_COUNT_ENTER_INTERVAL) {
+                noInterrupts();
+                hallGateLastEdge = HALL_INPUT_CAPTURE ? hallLastCapture : hallLastTime;
+                hallCountEdges = 0;
+                hallCountMode = true;
+                interrupts();
+            }
+
             // Calculate speed in km/h * 100 using integer math
             // km/h = (pulse freq [Hz] * 3600) / (TEETH_PER_REV * REVS_PER_KM)
             // pulse freq = 1,000,000 / pulseInterval (in microseconds)
             // km/h * 100 = (1,000,000 * 3600 * 100) / (pulseInterval * TEETH_PER_REV * REVS_PER_KM)
             // Simplify: (360,000,000,000) / (pulseInterval * TEETH_PER_REV * REVS_PER_KM)
+            // Numerator is 360,000,000 corrected for measured clock drift (timebase.cpp)
             unsigned long divisor = (unsigned long)TEETH_PER_REV * (unsigned long)REVS_PER_KM;
-            unsigned int speedRaw = (unsigned int)(360000000UL / (medianInterval * divisor / 1000UL));
+            unsigned int speedRaw = (unsigned int)(timebaseHallNumerator / (medianInterval * divisor / 1000UL));
             hallSpeedRaw = speedRaw / 100.0;  // Keep for compatibility (MPH)
             
             // EMA filter with integer math
@@ -385,6 +510,8 @@ void hallSpeedUpdate() {
  * 1. Only integrates distance if speed > 2 km/h (reduces drift when stationary)
  * 2. Calculates distance: distance (km) = speed (km/h) * time (ms) * 2.77778e-7
  *    - Conversion factor: 1 km/h = 1000m/3600s = 0.277778 m/s = 2.77778e-7 km/ms
+ *    - The factor carries the GPS-measured millis() drift (timebaseKmPerKmhMs),
+ *      so local intervals integrate as true time at no extra cost
  * 3. Updates global odo and odoTrip variables
  * 4. Returns distance traveled for potential odometer motor movement
  * 
@@ -400,8 +527,8 @@ float updateOdometer(float speedKmh, unsigned long timeIntervalMs) {
     // Only integrate if speed > 2 km/h (reduces GPS drift errors when stationary)
     if (speedKmh > 2) {
         // Calculate distance traveled: distance (km) = speed (km/h) * time (ms) * conversion factor
-        // Conversion: 1 km/h = 1000m/3600s = 0.277778 m/s = 2.77778e-7 km/ms
-        distanceTraveled = speedKmh * timeIntervalMs * 2.77778e-7;
+        // Conversion: 1 km/h = 1000m/3600s = 0.277778 m/s = 2.77778e-7 km/ms (drift-corrected)
+        distanceTraveled = speedKmh * timeIntervalMs * timebaseKmPerKmhMs;
     }
     
     // Update odometers
@@ -414,79 +541,262 @@ float updateOdometer(float speedKmh, unsigned long timeIntervalMs) {
 /**
  * ignitionPulseISR - Interrupt service routine for engine RPM measurement
  * 
- * ISR Design: Lightweight with minimal calculation
- * - Captures pulse timestamp using micros()
+ * ISR Design: Timestamp and enqueue only
+ * - Captures pulse timestamp using micros() (TIMER4_CAPT_vect when IGNITION_INPUT_CAPTURE)
  * - Debounces using RPM_DEBOUNCE_MICROS to suppress coil-ringdown echoes
- * - Calculates pulse interval
- * - Computes RPM using integer math and division
- * - Applies plausibility check to reject spikes (>50% change when RPM > 500)
- * - Applies exponential moving average filter
- * 
- * Performance: ~10-15 µs execution time
+ * - Pushes the pulse interval into ignIntervalBuffer for engineRPMUpdate()
  * 
- * Note: Division in ISR is not ideal but acceptable here because:
- * - Engine pulses are relatively infrequent (max ~300 Hz at 18k RPM)
- * - Calculation is simple enough to complete quickly
- * - No complex loops or blocking operations
- * 
- * Alternative considered but not implemented:
- * - Could defer division to main loop (capture interval only in ISR)
- * - Current approach is simpler and performs adequately
+ * Performance: ~3-4 µs execution time (no division, no filtering)
  */
 void ignitionPulseISR() {
     unsigned long currentTime = micros();
-    unsigned long pulseInterval = currentTime - ignitionLastTime;
+    if (ignitionProcessInterval(currentTime - ignitionLastTime)) {
+        ignitionLastTime = currentTime;
+    }
+}
 
+/**
+ * ignitionProcessInterval - Debounce and enqueue one ignition interval (ISR context)
+ * @param pulseInterval - Time since last accepted pulse (μs)
+ * @return true if the pulse was accepted (caller updates its baseline)
+ * 
+ * Shared by ignitionPulseISR() (micros() timestamps) and the Timer4 input capture ISR.
+ */
+static bool ignitionProcessInterval(unsigned long pulseInterval) {
     // Debounce: reject pulses arriving sooner than RPM_DEBOUNCE_MICROS after the last
     // accepted pulse. This suppresses coil-ringdown echoes that cause spurious RPM spikes.
-    // ignitionLastTime is intentionally NOT updated here so the next real pulse is measured
+    // The baseline is intentionally NOT updated here so the next real pulse is measured
     // from the correct baseline.
     if (pulseInterval < RPM_DEBOUNCE_MICROS) {
-        return;
+        return false;
     }
 
+    // Enqueue interval; head is free-running and masked on access
+    ignIntervalBuffer[ignIntervalHead & IGN_INTERVAL_BUFFER_MASK] = pulseInterval;
+    ignIntervalHead++;
+    return true;
+}
+
+/**
+ * triggerWheelISR - Interrupt handler for crank trigger wheel teeth
+ * 
+ * Used instead of ignitionPulseISR() when TRIGGER_WHEEL_TEETH > 0.
+ * Every edge is a tooth, so there is no debounce; the per-edge work is a
+ * few adds and one compare (36-1 at 10k RPM = 6 kHz of edges).
+ */
+void triggerWheelISR() {
+    unsigned long currentTime = micros();
+    triggerWheelProcessTooth(currentTime - ignitionLastTime);
     ignitionLastTime = currentTime;
+}
 
-    // Calculate RPM using integer math:
-    // RPM = (1,000,000 μs/sec * 120 sec/2min) / (pulseInterval * CYL_COUNT)
-    // RPM = 120,000,000 / (pulseInterval * CYL_COUNT)
-    // Note: CYL_COUNT is 2x old PULSES_PER_REVOLUTION, so we use 120M instead of 60M
-    int rpmRaw = (int)(120000000UL / (pulseInterval * CYL_COUNT));
-
-    // Plausibility check: reject RPM spikes.
-    // If the engine is above 500 RPM and the new reading changes more than 50%
-    // (up or down) from the current filtered value, discard this pulse.
-    // Note: engine shutdown is handled by engineRPMUpdate() which resets RPM to
-    // zero after IGNITION_PULSE_TIMEOUT (500 ms) of no pulses, independently of
-    // this check, so a stopped engine will never be held at a high RPM value.
-    if (engineRPMEMA > 500) {
-        int halfEMA = engineRPMEMA >> 1;  // 50% of current filtered RPM
-        if (rpmRaw > engineRPMEMA + halfEMA || rpmRaw < engineRPMEMA - halfEMA) {
-            return;  // Spike detected – hold previous reading
+/**
+ * triggerWheelProcessTooth - Count teeth and detect the missing-tooth gap (ISR context)
+ * @param toothInterval - Time since previous tooth edge (μs)
+ * 
+ * The gap is an interval > 1.5× the previous one (2× for 36-1, 3× for 60-2).
+ * When the gap arrives after exactly (TEETH - MISSING) edges the wheel is in
+ * sync and the revolution period is enqueued for engineRPMUpdate(). Any other
+ * count means a lost or noise edge, so that revolution is dropped.
+ */
+static void triggerWheelProcessTooth(unsigned long toothInterval) {
+    wheelRevAccum += toothInterval;
+    wheelToothCount++;
+
+    if (toothInterval > toothIntervalPrev + (toothIntervalPrev >> 1)) {
+        if (wheelToothCount == (uint8_t)(TRIGGER_WHEEL_TEETH - TRIGGER_WHEEL_MISSING)) {
+            ignIntervalBuffer[ignIntervalHead & IGN_INTERVAL_BUFFER_MASK] = wheelRevAccum;
+            ignIntervalHead++;
         }
+        wheelRevAccum = 0;
+        wheelToothCount = 0;
     }
+    toothIntervalPrev = toothInterval;
+}
 
-    engineRPMRaw = rpmRaw;
+// ===== INPUT CAPTURE TIMESTAMPS =====
+// Timer4/Timer5 free-run at F_CPU/8 = 2 MHz (0.5 µs per tick). The edge latches
+// TCNTn into ICRn in hardware, so ISR latency does not affect the measurement.
+// Overflow counts extend the 16-bit capture to 32 bits (wraps after ~35 minutes,
+// harmless since only differences are used).
+static volatile uint16_t hallCaptureOverflows = 0;
+static volatile uint16_t ignitionCaptureOverflows = 0;
+static unsigned long ignitionLastCapture = 0;  // Last accepted ignition capture (ticks)
 
-    // Apply exponential moving average filter with integer math
-    // FILTER_ENGINE_RPM is 0-256: higher value = less filtering
-    engineRPMEMA = (int)(((int32_t)rpmRaw * FILTER_ENGINE_RPM + (int32_t)engineRPMEMA * (256 - FILTER_ENGINE_RPM)) >> 8);
+/**
+ * extendCapture - Combine 16-bit ICR value with the software overflow count
+ * 
+ * If an overflow is pending (TOVn set but not yet serviced) and the captured
+ * value is in the lower half, the capture happened after the wrap.
+ */
+static inline unsigned long extendCapture(uint16_t icr, uint16_t overflows, bool overflowPending) {
+    if (overflowPending && icr < 0x8000) {
+        overflows++;
+    }
+    return ((unsigned long)overflows << 16) | icr;
+}
 
-    // Uncomment for debugging (note: Serial.print in ISR can cause timing issues)
-    // Serial.print("RPM: ");
-    // Serial.println(engineRPMEMA);
+/**
+ * initHallInputCapture - Route Hall sensor to Timer5 input capture (ICP5)
+ */
+void initHallInputCapture() {
+    pinMode(HALL_ICP_PIN, INPUT_PULLUP);
+    noInterrupts();
+    TCCR5A = 0;                              // Normal mode, no output compare
+    TCCR5B = _BV(ICNC5) | _BV(CS51);         // Noise canceller, falling edge, prescaler 8
+    TIFR5 = _BV(ICF5) | _BV(TOV5);           // Clear stale flags
+    TIMSK5 = _BV(ICIE5) | _BV(TOIE5);        // Capture + overflow interrupts
+    interrupts();
 }
 
 /**
- * engineRPMUpdate - Handle engine RPM timeout and minimum threshold
+ * initIgnitionInputCapture - Route ignition pulses to Timer4 input capture (ICP4)
+ */
+void initIgnitionInputCapture() {
+    pinMode(IGNITION_ICP_PIN, INPUT_PULLUP);
+    noInterrupts();
+    TCCR4A = 0;                              // Normal mode, no output compare
+    TCCR4B = _BV(ICNC4) | _BV(CS41);         // Noise canceller, falling edge, prescaler 8
+    TIFR4 = _BV(ICF4) | _BV(TOV4);           // Clear stale flags
+    TIMSK4 = _BV(ICIE4) | _BV(TOIE4);        // Capture + overflow interrupts
+    interrupts();
+}
+
+ISR(TIMER5_OVF_vect) {
+    hallCaptureOverflows++;
+}
+
+ISR(TIMER4_OVF_vect) {
+    ignitionCaptureOverflows++;
+}
+
+/**
+ * TIMER5_CAPT_vect - Hall sensor edge latched by ICP5
+ * 
+ * Interval is measured in 0.5 µs ticks and rounded to µs for the existing
+ * filter chain. micros() is still used for timeout/decay bookkeeping.
+ */
+ISR(TIMER5_CAPT_vect) {
+    unsigned long ticks = extendCapture(ICR5, hallCaptureOverflows, TIFR5 & _BV(TOV5));
+    if (hallCountMode) {
+        hallCountLastEdge = ticks;
+        hallCountEdges++;
+        return;
+    }
+    unsigned long currentTime = micros();
+    if (hallProcessInterval((ticks - hallLastCapture + 1) >> 1, currentTime)) {
+        hallLastCapture = ticks;
+        hallLastTime = currentTime;
+    }
+}
+
+/**
+ * TIMER4_CAPT_vect - Ignition pulse edge latched by ICP4
+ */
+ISR(TIMER4_CAPT_vect) {
+    unsigned long ticks = extendCapture(ICR4, ignitionCaptureOverflows, TIFR4 & _BV(TOV4));
+    unsigned long pulseInterval = (ticks - ignitionLastCapture + 1) >> 1;
+    if (TRIGGER_WHEEL_TEETH > 0) {
+        triggerWheelProcessTooth(pulseInterval);
+        ignitionLastCapture = ticks;
+        ignitionLastTime = micros();
+    } else if (ignitionProcessInterval(pulseInterval)) {
+        ignitionLastCapture = ticks;
+        ignitionLastTime = micros();
+    }
+}
+
+/**
+ * engineRPMUpdate - Compute engine RPM from queued ignition intervals
+ * 
+ * Drains intervals queued by ignitionPulseISR(), rejects spikes, and averages
+ * over the last CYL_COUNT intervals (one full engine cycle) so uneven firing
+ * cancels out. A single division and EMA step is done per call.
+ * 
+ * Trigger wheel mode queues one revolution period per entry, so the cycle is
+ * 2 entries (4-stroke) and the same formula yields RPM.
  */
 void engineRPMUpdate() {
     unsigned long currentTime = micros();
-    
+
+    // Snapshot ISR-owned state atomically (multi-byte values)
+    noInterrupts();
+    uint8_t head = ignIntervalHead;
+    unsigned long lastPulse = ignitionLastTime;
+    interrupts();
+
     // If it's been too long since last pulse, engine has stopped
-    if ((currentTime - ignitionLastTime) > IGNITION_PULSE_TIMEOUT) {
+    if ((currentTime - lastPulse) > IGNITION_PULSE_TIMEOUT) {
         engineRPMRaw = 0;
         engineRPMEMA = 0;
+        ignIntervalTail = head;
+        ignCycleCount = 0;
+        ignCycleSum = 0;
+        return;
+    }
+
+    // Window length follows CYL_COUNT (2 revolutions in trigger wheel mode);
+    // restart the cycle average if it changes
+    uint8_t cylCount = (TRIGGER_WHEEL_TEETH > 0) ? 2 : constrain(CYL_COUNT, 1, IGN_CYCLE_WINDOW_MAX);
+    if (cylCount != ignCycleLen) {
+        ignCycleLen = cylCount;
+        ignCycleCount = 0;
+        ignCycleSum = 0;
+    }
+
+    // If the ISR lapped the buffer, skip to the oldest interval still held
+    if ((uint8_t)(head - ignIntervalTail) > IGN_INTERVAL_BUFFER_SIZE) {
+        ignIntervalTail = head - IGN_INTERVAL_BUFFER_SIZE;
+    }
+
+    // Plausibility window in the interval domain: RPM within ±50% of the
+    // filtered value maps to interval between 2/3 and 2x of the expected one.
+    unsigned long expectedInterval = 0;
+    if (engineRPMEMA > 500) {
+        expectedInterval = 120000000UL / ((unsigned long)engineRPMEMA * cylCount);
+    }
+
+    bool newData = false;
+    while (ignIntervalTail != head) {
+        unsigned long interval = ignIntervalBuffer[ignIntervalTail & IGN_INTERVAL_BUFFER_MASK];
+        ignIntervalTail++;
+
+        // First pulse after a stop measures from a stale baseline - discard
+        if (interval > IGNITION_PULSE_TIMEOUT) {
+            continue;
+        }
+
+        // Spike detected – hold previous reading
+        if (expectedInterval > 0 &&
+            (interval * 3 < expectedInterval * 2 || interval > expectedInterval * 2)) {
+            continue;
+        }
+
+        // Slide the one-cycle window: drop the oldest interval once full
+        if (ignCycleCount == ignCycleLen) {
+            ignCycleSum -= ignCycleWindow[ignCycleIndex];
+        } else {
+            ignCycleCount++;
+        }
+        ignCycleWindow[ignCycleIndex] = interval;
+        ignCycleSum += interval;
+        ignCycleIndex++;
+        if (ignCycleIndex >= ignCycleLen) {
+            ignCycleIndex = 0;
+        }
+        newData = true;
+    }
+
+    if (newData && ignCycleSum > 0) {
+        // RPM = 120,000,000 / (meanInterval * CYL_COUNT)
+        //     = 120,000,000 * count / (sum * CYL_COUNT)
+        // Note: CYL_COUNT is 2x old PULSES_PER_REVOLUTION, so we use 120M instead of 60M
+        int rpmRaw = (int)((timebaseRpmNumerator / ignCycleSum) * ignCycleCount / cylCount);  // Drift-corrected 120,000,000
+        engineRPMRaw = rpmRaw;
+
+        // Apply exponential moving average filter with integer math
+        // FILTER_ENGINE_RPM is 0-256: higher value = less filtering
+        engineRPMEMA = (int)(((int32_t)rpmRaw * FILTER_ENGINE_RPM + (int32_t)engineRPMEMA * (256 - FILTER_ENGINE_RPM)) >> 8);
     }
     
     // Clamp very low RPM to zero for display stability
@@ -583,11 +893,79 @@ float curveLookup(uint16_t input, const uint16_t brkpts[], const uint8_t curve[]
     return curve[curveLength - 1] / 10.0f;
 }
 
+/**
+ * fuseSpeed - Combine Hall, CAN and GPS speed into one low-latency reading
+ * 
+ * - Hall (scaled by hallScale) is the primary source: fastest response
+ * - hallScale is learned against GPS at steady cruise, cancelling REVS_PER_KM
+ *   and tyre-wear error without GPS lag entering the needle
+ * - Falls back Hall -> CAN -> GPS when a source goes stale or faulty
+ * - Source switches are bumpless: the step is held as an offset that decays
+ * 
+ * @return Fused speed in km/h * 100
+ */
+static int fuseSpeed() {
+    unsigned long now = millis();
+    bool gpsFresh = fixGPS && (now - t_new) < GPS_STALE_MS;
+    bool canFresh = spdCANTime != 0 && (now - spdCANTime) < CAN_SPEED_STALE_MS;
+
+    // Hall is trusted while pulsing, or while no other source reports motion
+    noInterrupts();
+    unsigned long lastHallPulse = hallLastTime;
+    interrupts();
+    unsigned int reference = gpsFresh ? (unsigned int)spdGPS : (canFresh ? spdCAN : 0);
+    if ((micros() - lastHallPulse) < HALL_PULSE_TIMEOUT || reference < HALL_FAULT_SPEED) {
+        fusionHallOkTime = now;
+    }
+    bool hallValid = (now - fusionHallOkTime) < HALL_FAULT_MS;
+
+    // Learn Hall scale once per GPS fix while cruising steadily
+    if (gpsFresh && t_new != fusionLastGPSTime) {
+        long gpsDelta = (long)spdGPS - (long)fusionPrevGPS;
+        bool steady = gpsDelta > -100 && gpsDelta < 100;  // < 1 km/h change between fixes
+        if (hallValid && steady && spdGPS > SPEED_CAL_MIN && spdHall > 0) {
+            float ratio = (float)spdGPS / spdHall;
+            if (ratio > 0.8 && ratio < 1.2) {  // Reject wheelspin, lockup, bad fixes
+                hallScale += (ratio - hallScale) * ALPHA_SPEED_CAL * (1.0 / 256);
+            }
+        }
+        fusionPrevGPS = spdGPS;
+        fusionLastGPSTime = t_new;
+    }
+
+    // Pick the best available source
+    uint8_t source = 0;
+    int target = 0;
+    if (hallValid) {
+        source = 2;
+        target = (int)(spdHall * hallScale);
+    } else if (canFresh) {
+        source = 1;
+        target = spdCAN;
+    } else if (gpsFresh) {
+        source = 3;
+        target = (int)spdGPS;
+    }
+
+    if (source != fusionSource) {
+        fusionOffset = fusionOutput - target;
+        fusionSource = source;
+    }
+    fusionOffset = (int)(((long)fusionOffset * 7) / 8);  // ~80ms time constant at 10ms updates
+
+    int fused = target + fusionOffset;
+    if (fused < 0) {
+        fused = 0;
+    }
+    fusionOutput = fused;
+    return fused;
+}
+
 /**
  * sigSelect - Process and route sensor data
  */
 void sigSelect (void) {
-    // Select vehicle speed source: 0=off, 1=CAN, 2=Hall sensor, 3=GPS, 4=Synthetic (debug), 5=Odometer test
+    // Select vehicle speed source: 0=off, 1=CAN, 2=Hall sensor, 3=GPS, 4=Synthetic (debug), 5=Odometer test, 6=Serial, 7=Fused
     switch (SPEED_SOURCE) {
         case 0:  // Off
             spd = 0;
@@ -599,7 +977,7 @@ void sigSelect (void) {
             spd = spdHall;  // Already in km/h * 100 format
             break;
         case 3:  // GPS speed source
-            spd = spdGPS;  // Already in km/h * 100 format
+            spd = gpsSpeedNow();  // Dead-reckoned between fixes, km/h * 100 format
             break;
         case 4:  // Synthetic speed source (for debugging)
             spd = generateSyntheticSpeed();  // Returns km/h * 100 format
@@ -610,6 +988,9 @@ void sigSelect (void) {
         case 6:  // Serial signal source: speed set via serial commands
             spd = spdSerial;  // Already in km/h * 100 format
             break;
+        case 7:  // Fused Hall + CAN + GPS
+            spd = fuseSpeed();  // Returns km/h * 100 format
+            break;
         default:  // Fallback to off
             spd = 0;
             break;
@@ -664,6 +1045,22 @@ void sigSelect (void) {
         lastSerialOdometerUpdateTime = millis();
     }
     
+    // Update odometer for fused speed source
+    if (SPEED_SOURCE == 7 && lastFusedOdometerUpdateTime != 0) {
+        unsigned long currentTime = millis();
+        unsigned long timeIntervalMs = currentTime - lastFusedOdometerUpdateTime;
+        // spd is in km/h * 100 format, convert to km/h for updateOdometer
+        float speedKmh = spd * 0.01;
+        float distTraveled = updateOdometer(speedKmh, timeIntervalMs);
+        if (distTraveled > 0) {
+            moveOdometerMotor(distTraveled);
+        }
+        lastFusedOdometerUpdateTime = currentTime;
+    } else if (SPEED_SOURCE == 7 && lastFusedOdometerUpdateTime == 0) {
+        // Initialize the timer on first run
+        lastFusedOdometerUpdateTime = millis();
+    }
+    
     // Select engine RPM source: 0=off, 1=CAN, 2=coil negative, 3=synthetic (debug), 4=Serial
     switch (RPM_SOURCE) {
         case 0:  // Off
@@ -88,21 +88,52 @@ void hallSpeedISR();
  */
 void hallSpeedUpdate();
 
+/**
+ * initHallInputCapture - Configure Timer5 input capture for the Hall sensor
+ * 
+ * Timestamps Hall edges on HALL_ICP_PIN (ICP5) at 0.5 µs resolution in hardware.
+ * Replaces the HALL_PIN external interrupt when HALL_INPUT_CAPTURE is true.
+ * 
+ * Called from: setup()
+ */
+void initHallInputCapture();
+
+/**
+ * initIgnitionInputCapture - Configure Timer4 input capture for ignition pulses
+ * 
+ * Timestamps ignition edges on IGNITION_ICP_PIN (ICP4) at 0.5 µs resolution in hardware.
+ * Replaces the IGNITION_PULSE_PIN external interrupt when IGNITION_INPUT_CAPTURE is true.
+ * 
+ * Called from: setup()
+ */
+void initIgnitionInputCapture();
+
 /**
  * ignitionPulseISR - Interrupt service routine for engine RPM measurement
  * 
  * Triggered on each falling edge of the ignition coil pulse signal (via optocoupler).
- * Calculates engine RPM based on time between pulses and applies exponential moving average filter.
+ * Debounces and queues the time between pulses; RPM is computed in engineRPMUpdate().
  * 
  * Called from: Hardware interrupt on IGNITION_PULSE_PIN falling edge
  */
 void ignitionPulseISR();
 
 /**
- * engineRPMUpdate - Handle engine RPM timeout and minimum threshold
+ * triggerWheelISR - Interrupt handler for crank trigger wheels (36-1, 60-2, ...)
+ * 
+ * Counts teeth and detects the missing-tooth gap; queues one revolution period
+ * per turn for engineRPMUpdate(). Replaces ignitionPulseISR() when TRIGGER_WHEEL_TEETH > 0.
+ * 
+ * Called from: Hardware interrupt on IGNITION_PULSE_PIN falling edge
+ */
+void triggerWheelISR();
+
+/**
+ * engineRPMUpdate - Compute engine RPM from queued ignition intervals
  * 
- * Called periodically from main loop to detect when engine has stopped
- * and to clamp very low RPM values to zero for stable display.
+ * Called periodically from main loop. Averages the last CYL_COUNT intervals
+ * (one engine cycle) to cancel uneven firing, applies plausibility check and
+ * EMA filter, detects when engine has stopped, and clamps very low RPM to zero.
  * 
  * Called from: main loop every 20ms (ENGINE_RPM_UPDATE_RATE)
  */
@@ -0,0 +1,80 @@
+/*
+ * ========================================
+ * GPS-DISCIPLINED TIMEBASE IMPLEMENTATION
+ * ========================================
+ */
+
+#include "timebase.h"
+#include "config_hardware.h"
+
+float timebasePpm = 0;                              // Loaded from EEPROM in setup()
+float timebaseKmPerKmhMs = 2.77778e-7;
+unsigned long timebaseHallNumerator = 360000000UL;
+unsigned long timebaseRpmNumerator = 120000000UL;
+
+static long timebasePpmInt = 0;           // timebasePpm rounded, for timebaseCorrectMs()
+static bool timebaseAnchored = false;     // An anchor fix has been recorded
+static bool timebaseMeasured = false;     // At least one window completed this power cycle
+static unsigned long anchorGpsMs = 0;     // GPS time of the anchor fix
+static unsigned long anchorLocalMs = 0;   // millis() of the anchor fix
+
+/**
+ * timebaseUpdate - Feed one GPS fix into the drift estimate
+ */
+void timebaseUpdate(unsigned long gpsMs, unsigned long localMs, unsigned long wrapMs) {
+  if (!timebaseAnchored) {
+    anchorGpsMs = gpsMs;
+    anchorLocalMs = localMs;
+    timebaseAnchored = true;
+    return;
+  }
+
+  unsigned long gpsElapsed = (gpsMs >= anchorGpsMs) ? gpsMs - anchorGpsMs : gpsMs + wrapMs - anchorGpsMs;
+  unsigned long localElapsed = localMs - anchorLocalMs;
+  long error = (long)(gpsElapsed - localElapsed);
+
+  // Allowed disagreement: maximum drift over this span plus arrival jitter
+  long limit = (long)(gpsElapsed / (1000000UL / TIMEBASE_MAX_PPM)) + TIMEBASE_JITTER_MS;
+  if (error > limit || error < -limit) {
+    anchorGpsMs = gpsMs;  // Time jump or receiver restart: start a new window
+    anchorLocalMs = localMs;
+    return;
+  }
+
+  if (gpsElapsed < TIMEBASE_WINDOW_MS) {
+    return;
+  }
+
+  float ppm = (float)error * 1e6 / (float)localElapsed;
+  if (timebaseMeasured) {
+    timebasePpm += (ppm - timebasePpm) * 0.25;  // Smooth window-to-window jitter
+  } else {
+    timebasePpm = ppm;  // First window replaces the stored value (temperature may differ)
+    timebaseMeasured = true;
+  }
+  timebasePpm = constrain(timebasePpm, -(float)TIMEBASE_MAX_PPM, (float)TIMEBASE_MAX_PPM);
+  timebaseApply();
+
+  anchorGpsMs = gpsMs;
+  anchorLocalMs = localMs;
+}
+
+/**
+ * timebaseApply - Recompute the corrected conversion constants from timebasePpm
+ */
+void timebaseApply() {
+  float scale = 1.0 + timebasePpm * 1e-6;  // True ms per local ms
+  timebaseKmPerKmhMs = 2.77778e-7 * scale;
+  // Rates are events per true time: a local interval is 1/scale of the true one
+  timebaseHallNumerator = (unsigned long)(360000000.0 / scale);
+  timebaseRpmNumerator = (unsigned long)(120000000.0 / scale);
+  timebasePpmInt = (long)(timebasePpm + (timebasePpm >= 0 ? 0.5 : -0.5));
+}
+
+/**
+ * timebaseCorrectMs - Convert a local millis() interval to true milliseconds
+ */
+unsigned long timebaseCorrectMs(unsigned long localMs) {
+  // 64-bit product: localMs * ppm passes 2^31 within minutes at large drift
+  return localMs + (long)((int64_t)localMs * timebasePpmInt / 1000000L);
+}
@@ -0,0 +1,58 @@
+/*
+ * ========================================
+ * GPS-DISCIPLINED TIMEBASE
+ * ========================================
+ *
+ * Measures millis() drift against GPS time and corrects the intervals used
+ * for odometer integration and speed/RPM rate estimation
+ */
+
+#ifndef TIMEBASE_H
+#define TIMEBASE_H
+
+#include <Arduino.h>
+
+// Measured clock error: positive = millis() runs slow (true time elapses faster)
+extern float timebasePpm;
+
+// Conversion constants with the drift correction folded in (refreshed by timebaseApply()).
+// Consumers use these in place of their fixed constants, so correction costs nothing per call.
+extern float timebaseKmPerKmhMs;            // km per (km/h * local ms), nominal 2.77778e-7
+extern unsigned long timebaseHallNumerator; // Hall speed numerator, nominal 360000000
+extern unsigned long timebaseRpmNumerator;  // RPM numerator (µs per minute * 2), nominal 120000000
+
+/**
+ * timebaseUpdate - Feed one GPS fix into the drift estimate
+ *
+ * Compares elapsed GPS time against elapsed millis() between an anchor fix and
+ * the current fix. Once TIMEBASE_WINDOW_MS of GPS time has passed, the ppm
+ * error is measured, filtered into timebasePpm, applied, and the anchor moves
+ * forward. Arrival-time jitter (a few ms) is diluted over the window, so a
+ * 5 minute window resolves roughly 20 ppm.
+ *
+ * A gap between GPS and local elapsed time larger than any plausible drift
+ * (time jump, receiver restart) discards the window and re-anchors.
+ *
+ * @param gpsMs - Fix time from the receiver (ms, wraps at wrapMs)
+ * @param localMs - millis() when the fix arrived
+ * @param wrapMs - Rollover period of gpsMs (one day for NMEA, one week for UBX iTOW)
+ *
+ * Called from: fetchGPSdata() on every valid fix that carries time
+ */
+void timebaseUpdate(unsigned long gpsMs, unsigned long localMs, unsigned long wrapMs);
+
+/**
+ * timebaseApply - Recompute the corrected conversion constants from timebasePpm
+ *
+ * Called from: timebaseUpdate(), and setup() after timebasePpm is loaded from EEPROM
+ */
+void timebaseApply();
+
+/**
+ * timebaseCorrectMs - Convert a local millis() interval to true milliseconds
+ * @param localMs - Interval measured with millis() (any unsigned long)
+ * @return Interval corrected for the measured drift
+ */
+unsigned long timebaseCorrectMs(unsigned long localMs);
+
+#endif // TIMEBASE_H
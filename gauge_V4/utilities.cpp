@@ -7,9 +7,11 @@
 #include "utilities.h"
 #include "globals.h"
 #include "config_hardware.h"
+#include "can.h"
 #include "display.h"
 #include "outputs.h"
 #include "image_data.h"
+#include "timebase.h"
 #include <EEPROM.h>
 
 void shutdown (void){
@@ -18,14 +20,18 @@ void shutdown (void){
     EEPROM.update(i, dispArray1[i]);  // Only writes if changed
   }
   
-  // Save display 2 selection and units
-  EEPROM.update(dispArray2Address, dispArray2[0]);
+  // Save display 2 (and up) selections and units
+  for (byte p = 1; p < NUM_DISPLAYS; p++) {
+    EEPROM.update(panelSelectAddress(p), dispSelect[p]);
+  }
   EEPROM.update(unitsAddress, units);
   
   // Save odometer values (floats, 4 bytes each)
   EEPROM.put(odoAddress, odo);
   EEPROM.put(odoTripAddress, odoTrip);
   EEPROM.put(fuelSensorRawAddress, fuelSensorRaw);  // Remember fuel level for restart
+  EEPROM.put(hallScaleAddress, hallScale);           // Keep learned Hall calibration
+  EEPROM.put(timebasePpmAddress, timebasePpm);       // Keep measured clock drift
 
   // Clear LED tachometer immediately
   fill_solid(leds, NUM_LEDS, CRGB::Black);
@@ -33,11 +39,13 @@ void shutdown (void){
 
   // Display shutdown screens.
   display1.clearDisplay();
-  display1.drawBitmap(0, 0, IMG_FALCON_SCRIPT, SCREEN_W, SCREEN_H, 1);
-  display1.display();
-  display2.clearDisplay();
-  display2.drawBitmap(0, 0, IMG_2300_TURBO, SCREEN_W, SCREEN_H, 1);
-  display2.display();
+  drawImage(&display1, 0, 0, IMG_FALCON_SCRIPT);
+  flushDisplay(&display1);
+  for (byte p = 1; p < NUM_DISPLAYS; p++) {
+    displays[p].clearDisplay();
+    drawImage(&displays[p], 0, 0, IMG_2300_TURBO);
+    flushDisplay(&displays[p]);
+  }
 
   // Return gauge needles to zero position with synchronized timed stepping.
   // motorZeroTimed() disables the Timer3 ISR so the 10 kHz interrupt cannot
@@ -47,11 +55,11 @@ void shutdown (void){
   // Show splash screens
   delay(2000);
 
-  // Clear both displays before cutting power.
-  display1.clearDisplay();
-  display1.display();
-  display2.clearDisplay();
-  display2.display();
+  // Clear all displays before cutting power.
+  for (byte p = 0; p < NUM_DISPLAYS; p++) {
+    displays[p].clearDisplay();
+    flushDisplay(&displays[p]);
+  }
 
   // Double-check that key is still off (in case user turned it back on)
   if (vBatt > 1){
@@ -709,6 +717,7 @@ float generateSyntheticManifoldPressure(void) {
  * odometer (motor) and trip odometer (OLED display) against the expected value.
  * 
  * Returns 0 before the test starts and after it completes.
+ * Profile time is corrected for measured millis() drift, matching updateOdometer().
  * 
  * Returns: Speed in km/h * 100 format (e.g., 9656 = 96.56 km/h)
  */
@@ -726,7 +735,7 @@ int generateOdometerTestSpeed(void) {
         return 0;
     }
 
-    unsigned long elapsed = currentTime - TEST_START_MS;
+    unsigned long elapsed = timebaseCorrectMs(currentTime - TEST_START_MS);  // Profile runs on true time
 
     // Phase 1: Ramp up
     if (elapsed < RAMP_UP_MS) {
@@ -769,6 +778,9 @@ float mapFloat(float x, float in_min, float in_max, float out_min, float out_max
  *   "spd <kph>"       - Set speed in km/h (stored in spdSerial, km/h * 100 format)
  *   "rpm <value>"     - Set RPM (stored in rpmSerial)
  *   "odo motor <N>"   - Rotate odometer motor N revolutions; speed must be 0
+ *   "disp stats"      - Print and reset SPI bus utilisation and per-screen flush counts
+ *   "disp dump <N>"   - Print the next frame sent to display N (1 to NUM_DISPLAYS) as PBM
+ *   "can stats"       - Print and reset CAN receive counts and worst latency
  */
 void processSerialCommands(void) {
     static char buf[20];
@@ -793,6 +805,15 @@ void processSerialCommands(void) {
                     } else {
                         moveOdometerMotorRevs(atoi(buf + 10));
                     }
+                // Parse "disp stats" / "disp dump <N>"
+                } else if (bufLen >= 10 && strncmp(buf, "disp stats", 10) == 0) {
+                    displayStatsReport();
+                } else if (bufLen > 10 && strncmp(buf, "disp dump ", 10) == 0) {
+                    byte panel = atoi(buf + 10);
+                    if (panel >= 1 && panel <= NUM_DISPLAYS) displayDumpNext(panel);
+                // Parse "can stats"
+                } else if (bufLen >= 9 && strncmp(buf, "can stats", 9) == 0) {
+                    canStatsReport();
                 }
                 bufLen = 0;
             }
@@ -156,6 +156,9 @@ float mapFloat(float x, float in_min, float in_max, float out_min, float out_max
  *   "rpm <value>"     - Set RPM (sets rpmSerial used when RPM_SOURCE == 4)
  *   "odo motor <N>"   - Rotate odometer motor N revolutions (negative = reverse)
  *                       Only allowed when speed is 0; prints error otherwise.
+ *   "disp stats"      - Print and reset SPI bus utilisation (per-screen flush counts need DISPLAY_STATS)
+ *   "disp dump <N>"   - Print the next frame flushed to display N as a PBM image
+ *   "can stats"       - Print and reset CAN frames parsed/dropped and worst interrupt-to-parsed latency
  * 
  * Memory-efficient: uses a 20-byte static buffer, F() for string literals.
  * 